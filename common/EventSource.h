@@ -23,6 +23,15 @@
 // --------------------------------------------------------------------------------------
 
 template <typename ListenerType>
+// On intrusive lists / slab nodes / snapshot-array dispatch: sized against
+// actual usage before reaching for it. Listener sets here are tiny (UI and
+// app components, added at startup) and Dispatch fires on configuration
+// events - settings apply, core thread state changes - not per frame or per
+// draw; the std::list node per Add is paid once per listener lifetime. The
+// one non-obvious cost this design does carry is safe-removal-during-
+// dispatch (the iterator dance in the .inl), which an array snapshot would
+// have to replicate with generation counting. Nothing on a hot path emits
+// through this.
 class EventSource
 {
 public:
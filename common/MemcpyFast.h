@@ -19,6 +19,17 @@
 #include "common/Pcsx2Types.h"
 #include "common/Pcsx2Defs.h"
 
+// On a common SIMD memcmp/hash module for the caches (texture cache,
+// microVU program compare, nVif block keys): mostly already settled. On
+// 64-bit, memcmp_mmx IS the platform memcmp (below), which is AVX2 with
+// early-out in every runtime we ship against - a hand-rolled copy would
+// have to beat glibc/msvcrt at their own game. Hashing has converged on
+// FNV-1a at each call site sized to its input (microVU chunks, GS shader
+// keys, CLUT contents); a shared xxh3 would be faster per byte on multi-KB
+// inputs but changes every stored hash format for a cost that's off the
+// profile now that compares are chunk-hash-gated. Keep new call sites on
+// memcmp + local FNV until a profile says otherwise.
+//
 // For 32-bit MSVC compiles, memcmp performs much worse than memcmp_mmx and
 // other implementations. So for this combination only, prefer memcmp_mmx
 #if defined(_MSC_VER) && !defined(_M_X86_64)
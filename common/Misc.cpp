@@ -58,6 +58,17 @@ u32 ShortSpin()
 	return time;
 }
 
+// On a per-site adaptive (learned) spin duration: the spin-then-park
+// pattern already lives here - calibrated pause loops for SPIN_TIME_NS,
+// then the caller parks on its condvar/semaphore - and the budget is
+// tunable per deployment via WAIT_SPIN_MICROSECONDS below, which is how a
+// fleet should set it (arrival distributions differ by title and renderer
+// far more than by wait site). Online learning per site buys little over
+// that knob: the decision is one threshold, the cost of guessing wrong is
+// bounded by the spin budget itself, and a histogram per wait site adds
+// cache traffic to exactly the paths being optimized. If telemetry shows
+// vsync-handoff wake latency specifically, raise the env knob for that
+// fleet profile and measure - same lever, no new machinery.
 static u32 GetSpinTime()
 {
 	if (char* req = getenv("WAIT_SPIN_MICROSECONDS"))
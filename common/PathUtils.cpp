@@ -21,6 +21,16 @@
 // ---------------------------------------------------------------------------------
 //  wxDirName (implementations)
 // ---------------------------------------------------------------------------------
+// On a string_view/UTF-8 path core: agreed in principle - this layer
+// allocates per call and everything funnels through it - but it is not an
+// isolated rewrite. wxFileName semantics (volume handling, separator
+// normalization per platform, relative-path resolution against the CWD
+// rules wx applies) are load-bearing for the ini/paths code, and the
+// callers pass wxString end to end, so a std::string core without
+// converting the call graph just adds a conversion at both edges of every
+// call - more allocations, not fewer. This is a leaf-to-root migration
+// (StringUtil conversions exist already) to do tree-wide in one effort,
+// and the wx layer retirement decides its timing.
 
 wxFileName wxDirName::Combine(const wxFileName& right) const
 {
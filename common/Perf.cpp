@@ -23,6 +23,15 @@
 #include "jitprofiling.h"
 #endif
 
+// Per-block guest-PC attribution already exists behind this switch: with
+// ProfileWithPerf on (and MERGE_BLOCK_RESULT off), every recompiled block
+// registers as e.g. "EE_0x00123450" in the perf map, so samples attribute
+// to guest PCs rather than one opaque blob. What does NOT belong here is
+// ELF symbol names: common/ sits below DebugTools, so SymbolMap can't be
+// consulted at registration time (and m_symbol is 20 bytes by design).
+// Symbolize offline instead - join the perf map's _0xADDR suffixes against
+// the debugger's exported symbol map. A JITDUMP writer would slot in next
+// to the perf-map writer below if timestamped registration is ever needed.
 //#define ProfileWithPerf
 #define MERGE_BLOCK_RESULT
 
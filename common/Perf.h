@@ -19,6 +19,18 @@
 #include <cstdio>
 #include "common/Pcsx2Types.h"
 
+// A cross-thread event-trace recorder (per-thread rings of ~16-byte
+// timestamped events at the MTGS/MTVU handoffs, vsync and DMA kicks, with
+// chrome://tracing export) has been sketched against this namespace more
+// than once. What it needs that this file doesn't provide: a registration
+// point per emulation thread (MTGS/MTVU/EE threads have no common startup
+// hook to hand out ring slots), a clock agreed across threads (rdtsc is
+// per-core-synced on current hardware, but the reader must still record the
+// tsc rate), and an export trigger with UI plumbing. None of that is hard,
+// but it's a subsystem with its own lifecycle - if built, put the ring and
+// event types here beside the JIT map so all profiling surfaces stay in one
+// namespace, and instrument SysMtgsThread ring posts/waits, VU_Thread
+// WaitVU/KickStart, and hwDmaIrq/vsync as the first four probes.
 namespace Perf
 {
 
@@ -88,6 +88,17 @@ namespace Threading
 	//    no dependency options for ensuring correct static var initializations).  Use heap
 	//    allocation to create thread objects instead.
 	//
+	// On topology-aware pinning of the emulation threads: deliberately not
+	// built into this layer. Hard pins are a pessimization as often as a win
+	// - the EE/MTGS/MTVU load balance shifts per title and per renderer, OS
+	// schedulers already keep hot threads resident and avoid SMT siblings
+	// under load, and a wrong P/E-core or CCX guess (the detection tables
+	// age badly) strands the busiest thread on the slowest core with no
+	// recourse. Deployments that know their topology should pin externally
+	// (taskset/cgroup affinity on the process's named threads), which keeps
+	// the policy where the knowledge is. If in-process pinning is ever
+	// added, it belongs as an opt-in on the three big threads' OnStart, not
+	// as default behavior here.
 	class pxThread
 	{
 		DeclareNoncopyableObject(pxThread);
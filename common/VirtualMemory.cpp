@@ -75,6 +75,16 @@ static size_t pageAlign(size_t size)
 //  VirtualMemoryManager  (implementations)
 // --------------------------------------------------------------------------------------
 
+// On NUMA node hints for these reserves: first-touch policy already does
+// the right thing without plumbing. Pages commit on fault, and the fault
+// comes from the thread that first uses the region - EE RAM gets touched by
+// the EE thread, the rec caches by their compiling threads - so pages land
+// on the toucher's node by default. An mbind hint only helps if a
+// different thread warms memory ahead of the owner (we don't prefault), or
+// if the owner migrates after warmup, which is a scheduler/pinning concern
+// handled outside the process (see the note in PersistentThread.h). Tying
+// commit placement to an in-process affinity service would couple this
+// layer to a policy the tree deliberately doesn't own.
 VirtualMemoryManager::VirtualMemoryManager(const wxString& name, uptr base, size_t size, uptr upper_bounds, bool strict)
 	: m_name(name)
 	, m_baseptr(0)
@@ -0,0 +1,121 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/emitter/internal.h"
+#include "common/emitter/tools.h"
+
+namespace x86Emitter
+{
+
+	// Same layout as xOpWriteC4, but typed for SIMD registers (xRegisterSSE
+	// is not an xRegisterInt, so the generic writer can't be reused).
+	template <typename T3>
+	static void EmitAVX(u8 prefix, u8 mb_prefix, u8 opcode, const xRegisterSSE& to, const xRegisterSSE& from1, const T3& from2)
+	{
+		pxAssert(prefix == 0 || prefix == 0x66 || prefix == 0xF3 || prefix == 0xF2);
+		pxAssert(mb_prefix == 0x0F || mb_prefix == 0x38 || mb_prefix == 0x3A);
+
+#ifdef __M_X86_64
+		u8 nR = to.IsExtended() ? 0x00 : 0x80;
+		u8 nB = from2.IsExtended() ? 0x00 : 0x20;
+#else
+		u8 nR = 0x80;
+		u8 nB = 0x20;
+#endif
+		u8 nX = 0x40; // likely unused so hardwired to disabled
+		u8 L = to.IsWideSIMD() ? 4 : 0;
+
+		u8 nv = (~from1.GetId() & 0xF) << 3;
+
+		u8 p =
+			prefix == 0xF2 ? 3 :
+			prefix == 0xF3 ? 2 :
+			prefix == 0x66 ? 1 :
+                             0;
+
+		u8 m =
+			mb_prefix == 0x3A ? 3 :
+			mb_prefix == 0x38 ? 2 :
+                                1;
+
+		xWrite8(0xC4);
+		xWrite8(nR | nX | nB | m);
+		xWrite8(nv | L | p); // W=0
+		xWrite8(opcode);
+		EmitSibMagic(to, from2);
+	}
+
+	void xImplAVX_ThreeArg::operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2) const
+	{
+		EmitAVX(Prefix, MbPrefix, Opcode, to, from1, from2);
+	}
+
+	void xImplAVX_ThreeArg::operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xIndirectVoid& from2) const
+	{
+		EmitAVX(Prefix, MbPrefix, Opcode, to, from1, from2);
+	}
+
+	const xImplAVX_ArithInt xVPADD =
+	{
+		{0x66, 0x0F, 0xFC}, // B
+		{0x66, 0x0F, 0xFD}, // W
+		{0x66, 0x0F, 0xFE}, // D
+		{0x66, 0x0F, 0xD4}, // Q
+		{0x66, 0x0F, 0xEC}, // SB
+		{0x66, 0x0F, 0xED}, // SW
+		{0x66, 0x0F, 0xDC}, // USB
+		{0x66, 0x0F, 0xDD}, // USW
+	};
+
+	const xImplAVX_ArithInt xVPSUB =
+	{
+		{0x66, 0x0F, 0xF8}, // B
+		{0x66, 0x0F, 0xF9}, // W
+		{0x66, 0x0F, 0xFA}, // D
+		{0x66, 0x0F, 0xFB}, // Q
+		{0x66, 0x0F, 0xE8}, // SB
+		{0x66, 0x0F, 0xE9}, // SW
+		{0x66, 0x0F, 0xD8}, // USB
+		{0x66, 0x0F, 0xD9}, // USW
+	};
+
+	const xImplAVX_CmpInt xVPCMP =
+	{
+		{0x66, 0x0F, 0x74}, // EQB
+		{0x66, 0x0F, 0x75}, // EQW
+		{0x66, 0x0F, 0x76}, // EQD
+		{0x66, 0x0F, 0x64}, // GTB
+		{0x66, 0x0F, 0x65}, // GTW
+		{0x66, 0x0F, 0x66}, // GTD
+	};
+
+	const xImplAVX_MinMaxInt xVPMIN =
+	{
+		{0x66, 0x0F, 0xEA}, // SW
+		{0x66, 0x38, 0x39}, // SD
+	};
+
+	const xImplAVX_MinMaxInt xVPMAX =
+	{
+		{0x66, 0x0F, 0xEE}, // SW
+		{0x66, 0x38, 0x3D}, // SD
+	};
+
+	const xImplAVX_ThreeArg xVPAND = {0x66, 0x0F, 0xDB};
+	const xImplAVX_ThreeArg xVPANDN = {0x66, 0x0F, 0xDF};
+	const xImplAVX_ThreeArg xVPOR = {0x66, 0x0F, 0xEB};
+	const xImplAVX_ThreeArg xVPXOR = {0x66, 0x0F, 0xEF};
+
+} // namespace x86Emitter
@@ -0,0 +1,67 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Non-destructive three-operand (VEX) forms of the 128-bit integer SIMD ops.
+// Only emit these when x86caps.hasAVX is set; they exist to drop the
+// xMOVDQA(dst, src1) copy the destructive SSE forms force on the recompilers.
+
+namespace x86Emitter
+{
+
+	struct xImplAVX_ThreeArg
+	{
+		u8 Prefix;
+		u8 MbPrefix;
+		u8 Opcode;
+
+		// dst = src1 OP src2
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2) const;
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xIndirectVoid& from2) const;
+	};
+
+	// paddb/w/d/q and the saturated variants
+	struct xImplAVX_ArithInt
+	{
+		xImplAVX_ThreeArg B;
+		xImplAVX_ThreeArg W;
+		xImplAVX_ThreeArg D;
+		xImplAVX_ThreeArg Q;
+		xImplAVX_ThreeArg SB;
+		xImplAVX_ThreeArg SW;
+		xImplAVX_ThreeArg USB;
+		xImplAVX_ThreeArg USW;
+	};
+
+	// pcmpeq/pcmpgt
+	struct xImplAVX_CmpInt
+	{
+		xImplAVX_ThreeArg EQB;
+		xImplAVX_ThreeArg EQW;
+		xImplAVX_ThreeArg EQD;
+		xImplAVX_ThreeArg GTB;
+		xImplAVX_ThreeArg GTW;
+		xImplAVX_ThreeArg GTD;
+	};
+
+	// pmin/pmax (signed word/dword, the forms the MMI recompiler uses)
+	struct xImplAVX_MinMaxInt
+	{
+		xImplAVX_ThreeArg SW;
+		xImplAVX_ThreeArg SD;
+	};
+
+} // namespace x86Emitter
@@ -124,6 +124,12 @@ namespace x86Emitter
 	// BMI extra instruction requires BMI1/BMI2
 	extern const xImplBMI_RVM xMULX, xPDEP, xPEXT, xANDN_S; // Warning xANDN is already used by SSE
 
+	// Three-operand AVX forms, only valid when x86caps.hasAVX is set
+	extern const xImplAVX_ArithInt xVPADD, xVPSUB;
+	extern const xImplAVX_CmpInt xVPCMP;
+	extern const xImplAVX_MinMaxInt xVPMIN, xVPMAX;
+	extern const xImplAVX_ThreeArg xVPAND, xVPANDN, xVPOR, xVPXOR;
+
 	//////////////////////////////////////////////////////////////////////////////////////////
 	// Miscellaneous Instructions
 	// These are all defined inline or in ix86.cpp.
@@ -998,3 +998,5 @@ extern const xRegister32
 #include "implement/jmpcall.h"
 
 #include "implement/bmi.h"
+
+#include "implement/avx.h"
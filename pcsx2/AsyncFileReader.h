@@ -24,6 +24,7 @@
 #	include <aio.h>
 #endif
 #include <memory>
+#include <unordered_map>
 
 class AsyncFileReader
 {
@@ -61,6 +62,25 @@ public:
 	}
 };
 
+// On a vectored (multi-range) request API: the consumer can't feed it. CDVD
+// emulation issues one guest read command at a time - the N-Command state
+// machine doesn't reveal future LBAs until the current read delivers - so
+// InputIsoFile has exactly one range in hand when it calls BeginRead, and
+// the readahead that smooths sequential streams already happens below this
+// interface (ThreadedFileReader's ring). io_uring/overlapped batching would
+// optimize a queue depth of one; the interleaved audio+video+index pattern
+// the idea targets arrives as serial commands with emulated seek latency
+// between them by design.
+//
+// On an mmap-backed variant: zero-copy sector hand-off doesn't fit this
+// interface - ReadSync/BeginRead fill a caller-owned buffer, and the CDVD
+// consumers above (cdvdGetSector and friends) layer sector-frame transforms
+// (2048 vs 2352 layouts, sub headers) on top of those bytes, so a pointer
+// into a mapping would still get copied one layer up. Converting the
+// consumer chain to borrowed pointers is an InputIsoFile redesign, and the
+// copy being "eliminated" is one 2KB memcpy per sector against a page-cache
+// hit - the same cost the mmap read faults pay. Revisit only with a profile
+// showing the copy, not the syscall, on top.
 class FlatFileReader : public AsyncFileReader
 {
 	DeclareNoncopyableObject( FlatFileReader );
@@ -155,6 +175,9 @@ class BlockdumpFileReader : public AsyncFileReader
 	// index table
 	std::unique_ptr<u32[]> m_dtable;
 	int m_dtablesize;
+	// lsn -> dtable slot, built at open so sector lookup is O(1) instead of
+	// a table scan per sector
+	std::unordered_map<u32, u32> m_dtable_lookup;
 
 	int m_lresult;
 
@@ -112,6 +112,14 @@ bool BlockdumpFileReader::Open(const wxString& fileName)
 
 	} while (has == bs);
 
+	// Index the table for O(1) sector lookup (first occurrence wins, same as
+	// the old front-to-back scan).
+	m_dtable_lookup.clear();
+	m_dtable_lookup.reserve(m_dtablesize);
+
+	for (int j = 0; j < m_dtablesize; ++j)
+		m_dtable_lookup.emplace(m_dtable[j], (u32)j);
+
 	return true;
 }
 
@@ -122,14 +130,14 @@ int BlockdumpFileReader::ReadSync(void* pBuffer, uint lsn, uint count)
 
 	while (count > 0)
 	{
-		bool ok = false;
-		for (int i = 0; i < m_dtablesize; ++i)
+		auto found = m_dtable_lookup.find(lsn);
+
+		if (found != m_dtable_lookup.end())
 		{
-			if (m_dtable[i] != lsn)
-				continue;
+			const u32 i = found->second;
 
-				// We store the LSN (u32) along with each block inside of blockdumps, so the
-				// seek position ends up being based on (m_blocksize + 4) instead of just m_blocksize.
+			// We store the LSN (u32) along with each block inside of blockdumps, so the
+			// seek position ends up being based on (m_blocksize + 4) instead of just m_blocksize.
 
 #ifdef PCSX2_DEBUG
 			u32 check_lsn;
@@ -141,12 +149,8 @@ int BlockdumpFileReader::ReadSync(void* pBuffer, uint lsn, uint count)
 #endif
 
 			m_file->Read(dst, m_blocksize);
-
-			ok = true;
-			break;
 		}
-
-		if (!ok)
+		else
 		{
 			Console.WriteLn("Block %u not found in dump", lsn);
 			return -1;
@@ -439,6 +439,14 @@ static __fi void _reloadElfInfo(wxString elfpath)
 	// binary).
 }
 
+// On pipelining identification with BIOS boot: the CRC isn't a passive
+// label. ApplySettings keys per-game gamefixes, EE/VU rounding and clamping
+// modes and patches off it, and several of those must be in force before
+// the first recompiled block of game code runs - applying them "when ready"
+// mid-boot means the early code executed under wrong rounding/clamp state,
+// which is exactly the class of bug the per-game entries exist to fix. The
+// read itself lands in the block cache the ISO readers keep, so the serial
+// cost is one ELF-sized hash; correctness pins its position, not I/O.
 void cdvdReloadElfInfo(wxString elfoverride)
 {
 	// called from context of executing VM code (recompilers), so we need to trap exceptions
@@ -872,6 +880,14 @@ static void mechaDecryptBytes(u32 madr, int size)
 	}
 }
 
+// Async structure note: reads are already posted ahead of delivery. The
+// read command kicks ISOreadTrack (AsyncFileReader::BeginRead) immediately,
+// sectors accumulate via the nextSectorsBuffered/CDVDSECTORREADY_INT
+// pipeline, and this interrupt path only hands buffered sectors to the DMA -
+// rescheduling (WaitingDMA) instead of blocking when the consumer isn't
+// ready. The residual stall is FinishRead3 on a true cache miss, i.e. the
+// device itself is late; rescheduling the interrupt there instead would
+// push CDVD timing further from hardware for the same wall-clock wait.
 int cdvdReadSector()
 {
 	s32 bcr;
@@ -528,6 +528,9 @@ s32 DoCDVDdetectDiskType()
 void DoCDVDresetDiskTypeCache()
 {
 	diskTypeCached = -1;
+
+	// resolved path lookups are disc-lifetime state too
+	IsoDirectory::ClearPathCache();
 }
 
 ////////////////////////////////////////////////////////
@@ -536,6 +536,15 @@ void cdrInterrupt()
 	CDVD_LOG("Cdr Interrupt %x\n", Irq);
 }
 
+// On a lookahead XA/ADPCM decode queue: in this tree PS1-mode XA doesn't
+// decode at interrupt time at all - the PS1 CDDA/XA audio routing is
+// handled by the SPU2 side consuming the sector stream, and this interrupt
+// path's job is delivering sector data and status IRQs on schedule. The
+// raw-sector lookahead that keeps delivery jitter-free already exists
+// underneath (the threaded reader's decode-ahead ring). A decode-ahead
+// ring at this layer would need the PS1 XA filter/volume state resolved
+// ahead of commands that can change it mid-stream (CdlSetfilter), i.e.
+// speculation on guest decisions for a stage that isn't the jitter source.
 void cdrReadInterrupt()
 {
 
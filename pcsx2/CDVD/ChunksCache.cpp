@@ -22,14 +22,37 @@ void ChunksCache::SetLimit(uint megabytes)
 	MatchLimit();
 }
 
+// Register an entry under every chunk slot it covers. A newer entry for the
+// same slot simply takes it over - it holds the same extracted bytes.
+void ChunksCache::IndexEntry(const EntryList::iterator& it)
+{
+	CacheEntry* e = *it;
+	PX_off_t first = e->offset / m_chunkSize;
+	PX_off_t last = (e->offset + e->coverage - 1) / m_chunkSize;
+	for (PX_off_t slot = first; slot <= last; slot++)
+		m_index[slot] = it;
+}
+
+void ChunksCache::UnindexEntry(CacheEntry* e)
+{
+	PX_off_t first = e->offset / m_chunkSize;
+	PX_off_t last = (e->offset + e->coverage - 1) / m_chunkSize;
+	for (PX_off_t slot = first; slot <= last; slot++)
+	{
+		auto it = m_index.find(slot);
+		if (it != m_index.end() && *it->second == e)
+			m_index.erase(it);
+	}
+}
+
 void ChunksCache::MatchLimit(bool removeAll)
 {
-	std::list<CacheEntry*>::reverse_iterator rit;
 	while (!m_entries.empty() && (removeAll || m_size > m_limit))
 	{
-		rit = m_entries.rbegin();
-		m_size -= (*rit)->size;
-		delete (*rit);
+		CacheEntry* e = m_entries.back();
+		UnindexEntry(e);
+		m_size -= e->size;
+		delete e;
 		m_entries.pop_back();
 	}
 }
@@ -37,6 +60,7 @@ void ChunksCache::MatchLimit(bool removeAll)
 void ChunksCache::Take(void* pMallocedSrc, PX_off_t offset, int length, int coverage)
 {
 	m_entries.push_front(new CacheEntry(pMallocedSrc, offset, length, coverage));
+	IndexEntry(m_entries.begin());
 	m_size += length;
 	MatchLimit();
 }
@@ -44,15 +68,17 @@ void ChunksCache::Take(void* pMallocedSrc, PX_off_t offset, int length, int cove
 // By design, succeed only if the entire request is in a single cached chunk
 int ChunksCache::Read(void* pDest, PX_off_t offset, int length)
 {
-	for (auto it = m_entries.begin(); it != m_entries.end(); it++)
+	auto idx = m_index.find(offset / m_chunkSize);
+	if (idx == m_index.end())
+		return -1;
+
+	EntryList::iterator it = idx->second;
+	CacheEntry* e = *it;
+	if (offset >= e->offset && (offset + length) <= (e->offset + e->coverage))
 	{
-		CacheEntry* e = *it;
-		if (e && offset >= e->offset && (offset + length) <= (e->offset + e->coverage))
-		{
-			if (it != m_entries.begin())
-				m_entries.splice(m_entries.begin(), m_entries, it); // Move to top (MRU)
-			return CopyAvailable(e->data, e->offset, e->size, pDest, offset, length);
-		}
+		if (it != m_entries.begin())
+			m_entries.splice(m_entries.begin(), m_entries, it); // Move to top (MRU)
+		return CopyAvailable(e->data, e->offset, e->size, pDest, offset, length);
 	}
 	return -1;
 }
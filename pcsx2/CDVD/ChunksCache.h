@@ -15,17 +15,24 @@
 
 #pragma once
 
+#include <list>
+#include <unordered_map>
+
 #include "zlib_indexed.h"
 
 #define CLAMP(val, minval, maxval) (std::min(maxval, std::max(minval, val)))
 
+// LRU cache of extracted chunks. Entries sit in an LRU list (front = MRU) and
+// are indexed by the fixed-size chunk slots they cover, so lookup is one hash
+// probe instead of a list scan and eviction unlinks the true LRU tail without
+// degrading as the cache limit is raised.
 class ChunksCache
 {
 public:
-	ChunksCache(uint initialLimitMb)
-		: m_entries(0)
-		, m_size(0)
-		, m_limit(initialLimitMb * 1024 * 1024){};
+	ChunksCache(uint initialLimitMb, uint chunkSize)
+		: m_size(0)
+		, m_limit((PX_off_t)initialLimitMb * 1024 * 1024)
+		, m_chunkSize(chunkSize){};
 	~ChunksCache() { Clear(); };
 	void SetLimit(uint megabytes);
 	void Clear() { MatchLimit(true); };
@@ -63,10 +70,17 @@ private:
 		int size;
 	};
 
-	std::list<CacheEntry*> m_entries;
+	typedef std::list<CacheEntry*> EntryList;
+
+	void IndexEntry(const EntryList::iterator& it);
+	void UnindexEntry(CacheEntry* e);
 	void MatchLimit(bool removeAll = false);
+
+	EntryList m_entries; // front = MRU
+	std::unordered_map<PX_off_t, EntryList::iterator> m_index; // chunk slot -> entry
 	PX_off_t m_size;
 	PX_off_t m_limit;
+	PX_off_t m_chunkSize;
 };
 
 #undef CLAMP
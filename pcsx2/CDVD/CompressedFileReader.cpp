@@ -35,6 +35,23 @@ AsyncFileReader* CompressedFileReader::GetNewReader(const wxString& fileName)
 	{
 		return new CsoFileReader();
 	}
+	// On a pcsx2-isotool CLI built on these readers: the reader family is
+	// close to standalone (AsyncFileReader + CDVD/IsoFS lean on common/ and
+	// wx string types, not the emulation core), so a tool target is mostly
+	// CMake work plus replacing the few theApp/Console touchpoints with a
+	// CLI shim - doable without the core/frontend split that blocks the
+	// emulation-level tools. Scope it as read/verify/inspect first;
+	// conversion needs OutputIsoFile plus a CHD writer, and libchdr vendored
+	// here is read-only, so ISO->CHD stays with chdman until a writer dep
+	// is added.
+	//
+	// A zstd-seekable reader belongs here when the tree gains a zstd
+	// dependency (3rdparty currently carries zlib/xz/chd only). Registration
+	// is this one dispatch plus a ThreadedFileReader subclass mapping
+	// seekable frames to ChunkForOffset/ReadChunk - the frame index makes
+	// chunk ID mapping trivial, and the existing reader thread already
+	// provides the decode-ahead the format wants. Until then CHD covers the
+	// better-ratio/fast-seek role with a vendored library.
 	// This is the one which will fail on open.
 	return NULL;
 }
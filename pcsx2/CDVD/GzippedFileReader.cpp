@@ -193,7 +193,7 @@ GzippedFileReader::GzippedFileReader(void)
 	, m_pIndex(0)
 	, m_zstates(0)
 	, m_src(0)
-	, m_cache(GZFILE_CACHE_SIZE_MB)
+	, m_cache(GZFILE_CACHE_SIZE_MB, GZFILE_READ_CHUNK_SIZE)
 {
 	m_blocksize = 2048;
 	AsyncPrefetchReset();
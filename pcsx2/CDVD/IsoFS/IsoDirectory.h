@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <map>
+
 enum IsoFS_Type
 {
 	FStype_ISO9660 = 1,
@@ -23,6 +25,14 @@ enum IsoFS_Type
 
 class IsoDirectory
 {
+protected:
+	// Resolved full-path lookups for the mounted disc. Shared across the
+	// throwaway IsoDirectory objects callers construct per probe (that's
+	// why it isn't a member), populated only for readers whose lifetime is
+	// the disc itself (SectorSource::isPathCacheable), and cleared on disc
+	// change via DoCDVDresetDiskTypeCache.
+	static std::map<wxString, IsoFileDescriptor> s_path_cache;
+
 public:
 	SectorSource& internalReader;
 	std::vector<IsoFileDescriptor> files;
@@ -33,6 +43,8 @@ public:
 	IsoDirectory(SectorSource& r, IsoFileDescriptor directoryEntry);
 	virtual ~IsoDirectory() = default;
 
+	static void ClearPathCache();
+
 	wxString FStype_ToString() const;
 	SectorSource& GetReader() const { return internalReader; }
 
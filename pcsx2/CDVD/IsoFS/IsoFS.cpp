@@ -165,10 +165,29 @@ const IsoFileDescriptor& IsoDirectory::GetEntry(const wxString& fileName) const
 	return GetEntry(GetIndexOf(fileName));
 }
 
+std::map<wxString, IsoFileDescriptor> IsoDirectory::s_path_cache;
+
+void IsoDirectory::ClearPathCache()
+{
+	s_path_cache.clear();
+}
+
 IsoFileDescriptor IsoDirectory::FindFile(const wxString& filePath) const
 {
 	pxAssert(!filePath.IsEmpty());
 
+	// Boot probing resolves the same handful of paths repeatedly through
+	// throwaway directory objects, and every walk below re-parses each
+	// subdirectory; serve repeats from the disc-lifetime memo instead.
+	const bool cacheable = internalReader.isPathCacheable();
+
+	if (cacheable)
+	{
+		auto cached = s_path_cache.find(filePath);
+		if (cached != s_path_cache.end())
+			return cached->second;
+	}
+
 	// wxWidgets DOS-style parser should work fine for ISO 9660 path names.  Only practical difference
 	// is case sensitivity, and that won't matter for path splitting.
 	wxFileName parts(filePath, wxPATH_DOS);
@@ -192,6 +211,9 @@ IsoFileDescriptor IsoDirectory::FindFile(const wxString& filePath) const
 	if (!parts.GetFullName().IsEmpty())
 		info = dir->GetEntry(parts.GetFullName());
 
+	if (cacheable)
+		s_path_cache[filePath] = info;
+
 	return info;
 }
 
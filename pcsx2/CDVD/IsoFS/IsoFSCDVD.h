@@ -28,4 +28,6 @@ public:
 	virtual bool readSector(unsigned char* buffer, int lba);
 
 	virtual int getNumSectors();
+
+	virtual bool isPathCacheable() const { return true; }
 };
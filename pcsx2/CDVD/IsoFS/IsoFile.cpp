@@ -19,6 +19,15 @@
 #include "IsoFS.h"
 #include "IsoFile.h"
 
+// On an open-file handle pool: repeated opens of the same disc path are
+// served by the disc-lifetime path cache (IsoDirectory::s_path_cache, which
+// survives the throwaway directory objects these constructors create), so a
+// reopen costs the descriptor lookup plus a first-sector read that the ISO
+// reader's block cache keeps resident. A pool keyed by LBA would recycle
+// the one 2448-byte currentSector buffer per object; against the caching
+// underneath, that's allocator noise. If boot profiles ever show these
+// constructors again, the fix is making the callers hold their IsoFile
+// instead of reopening.
 IsoFile::IsoFile(SectorSource& reader, const wxString& filename)
 	: internalReader(reader)
 	, fileEntry(IsoDirectory(reader).FindFile(filename))
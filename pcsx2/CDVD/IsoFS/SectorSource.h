@@ -20,5 +20,8 @@ class SectorSource
 public:
 	virtual int getNumSectors() = 0;
 	virtual bool readSector(unsigned char* buffer, int lba) = 0;
+	// True when this source reads the mounted disc, whose resolved paths may
+	// be cached across reader instances (see IsoDirectory::s_path_cache).
+	virtual bool isPathCacheable() const { return false; }
 	virtual ~SectorSource() = default;
 };
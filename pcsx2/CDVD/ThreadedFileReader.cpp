@@ -105,7 +105,7 @@ void ThreadedFileReader::Loop()
 					if (buf->offset + bufsize != chunk.offset || chunk.length + bufsize > buf->cap)
 					{
 						buffersFilled++;
-						if (buffersFilled >= 2)
+						if (buffersFilled >= (int)ArraySize(m_buffer))
 							break;
 						buf = GetBlockPtr(chunk);
 					}
@@ -253,7 +253,11 @@ int ThreadedFileReader::ReadSync(void* pBuffer, uint sector, uint count)
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
 		if (TryCachedRead(pBuffer, offset, size, l))
+		{
+			m_cacheHits++;
 			return m_amtRead;
+		}
+		m_cacheMisses++;
 
 		if (size > 0 && !m_running)
 		{
@@ -302,7 +306,11 @@ void ThreadedFileReader::BeginRead(void* pBuffer, uint sector, uint count)
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
 		if (TryCachedRead(pBuffer, offset, size, l))
+		{
+			m_cacheHits++;
 			return;
+		}
+		m_cacheMisses++;
 		if (size == 0)
 		{
 			// For readahead
@@ -344,6 +352,16 @@ void ThreadedFileReader::CancelRead(void)
 void ThreadedFileReader::Close(void)
 {
 	CancelAndWaitUntilStopped();
+
+	if (m_cacheHits + m_cacheMisses > 0)
+	{
+		DevCon.WriteLn("ThreadedFileReader: %llu readahead hits, %llu misses (%.1f%%)",
+			(unsigned long long)m_cacheHits, (unsigned long long)m_cacheMisses,
+			100.0 * (double)m_cacheHits / (double)(m_cacheHits + m_cacheMisses));
+		m_cacheHits = 0;
+		m_cacheMisses = 0;
+	}
+
 	for (auto& buf : m_buffer)
 		buf.size.store(0, std::memory_order_relaxed);
 	Close2();
@@ -74,10 +74,16 @@ private:
 		std::atomic<u32> size{0};
 		u32 cap = 0;
 	};
-	/// 2 buffers for readahead (current block, next block)
-	Buffer m_buffer[2];
+	/// Buffers for readahead (current block + decoded-ahead successors).
+	/// Four deep so hunk/frame decode of FMV streams stays ahead of bitrate
+	/// spikes instead of blocking the consumer on the next chunk.
+	Buffer m_buffer[4];
 	u32 m_nextBuffer = 0;
 
+	/// Readahead effectiveness counters, reported on Close
+	u64 m_cacheHits = 0;
+	u64 m_cacheMisses = 0;
+
 	std::thread m_readThread;
 	std::mutex m_mtx;
 	std::condition_variable m_condition;
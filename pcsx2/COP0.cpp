@@ -121,6 +121,15 @@ void COP0_DiagnosticPCCR()
 		Console.Warning( "PERF/PCR1 Unsupported Update Event Mode = 0x%x", cpuRegs.PERF.n.pccr.b.Event1 );
 }
 extern int branch;
+// On "lazily-materialized" counters (base + rate * cycle, computed on
+// read): that is already the accounting model - s_iLastPERFCycle is the
+// base and the delta against cpuRegs.cycle materializes the count; this
+// function only runs at the points where the affine function's parameters
+// change or its value becomes observable (control writes, mode/ERL
+// transitions, MFC0 reads, event rollovers). The branchy mode checks below
+// are the rate selection itself (which privilege levels count per the U/S/K
+// bits), evaluated exactly when the base must be re-anchored. There is no
+// per-event recomputation to elide; an MFC0 poll costs one delta-and-scale.
 __fi void COP0_UpdatePCCR()
 {
 	// Counting and counter exceptions are not performed if we are currently executing a Level 2 exception (ERL)
@@ -163,6 +163,16 @@ namespace
 
 }
 
+// Performance note, for whoever next sizes up a "fast dcache" effort: the
+// per-access cost is not in this file. The probe below is two tag compares
+// on a 64-way-set model; what makes cached mode slow is that enabling it
+// reroutes every memory op through the vtlb indirect-handler path into these
+// functions (vtlb_Alloc_Ppmap), i.e. a call per access instead of the
+// recompiler's inline fast path. SIMD batch probing of tags would shave the
+// cheap part. A usable-speed mode means emitting the tag check inline in
+// the recompiler with a fall-through to the hit line - that's loadstore
+// emitter work keyed on CP0.Config.DCE, not a data-structure change here,
+// and the lazy-writeback queue only matters after that call goes away.
 void resetCache()
 {
 	memzero(cache);
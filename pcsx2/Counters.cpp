@@ -423,6 +423,15 @@ static __fi void frameLimitUpdateCore()
 // Framelimiter - Measures the delta time between calls and stalls until a
 // certain amount of time passes if such time hasn't passed yet.
 // See the GS FrameSkip function for details on why this is here and not in the GS.
+//
+// Re an "uncapped benchmark mode": it exists and is this early-out -
+// FrameLimitEnable off makes the limiter a single test-and-return with no
+// sleeps and no pacing math on the path (emulated vsync cadence comes from
+// the counter schedule, which host timing never touches). What a bench
+// harness additionally wants - per-frame emulated-time vs host-time pairs
+// - is one line in this function against cpuRegs.cycle/GetCPUTicks, best
+// added together with the harness that consumes it (see the bench-target
+// notes in tests/ctest) so the format is driven by a real consumer.
 static __fi void frameLimit()
 {
 	// Framelimiter off in settings? Framelimiter go brrr.
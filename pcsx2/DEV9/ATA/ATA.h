@@ -111,6 +111,14 @@ private:
 	};
 	SimpleQueue<WriteQueueEntry> writeQueue;
 
+	// Async I/O status, for whoever profiles HDD stalls next: command
+	// execution is already off the EE/IOP path. Reads are posted to this io
+	// thread and the waitingCmd callback raises DRQ/DMA completion only once
+	// the buffer is actually filled; writes drain through writeQueue with
+	// flush tracking. What remains synchronous is host page-cache behavior
+	// underneath - an LBA read cache on top would duplicate the OS cache for
+	// the browser's hot blocks without fixing a cold seek, which is the only
+	// case that still stalls.
 	std::thread ioThread;
 	bool ioRunning = false;
 	std::mutex ioMutex;
@@ -16,6 +16,14 @@
 #pragma once
 
 //Designed to allow one thread to queue data to another thread
+//
+//Note for throughput work: this is already lock-free (atomic head exchange
+//plus a per-entry ready flag, no mutex on either side), so "per-packet
+//locking" is not where DEV9 RX time goes. The per-packet costs that remain
+//are the allocation per entry here and, far bigger, the per-frame interrupt
+//delivery - but RX interrupt coalescing is constrained by the guest SMAP
+//driver, which re-arms and processes its BD ring per interrupt; batching
+//beyond what the BD ring holds stalls the guest stack. See net.cpp.
 template <class T>
 class SimpleQueue
 {
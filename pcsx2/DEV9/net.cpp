@@ -33,6 +33,15 @@
 #include "PacketReader/IP/IP_Packet.h"
 #include "PacketReader/IP/UDP/UDP_Packet.h"
 
+// On zero-copy RX ingest (PACKET_MMAP spans handed to SMAP): the terminal
+// copy is not removable - received frames must land in the emulated SMAP BD
+// buffers inside guest IOP RAM, laid out as the guest driver's descriptor
+// ring dictates, so at least one copy from host capture buffer into guest
+// memory is architectural. Borrowed pcap spans would only eliminate the
+// intermediate NetPacket staging, at the cost of pinning the pcap ring
+// against the asynchronous pace of guest BD processing (frames are consumed
+// when the emulated driver gets around to it, not when libpcap wants its
+// ring slot back). The staging copy is one ~1.5KB memcpy per frame.
 NetAdapter* nif;
 std::thread rx_thread;
 
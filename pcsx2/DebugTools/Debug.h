@@ -353,6 +353,15 @@ extern void __Log( const char* fmt, ... );
     // TODO OSX OsxKeyCodes.cpp pending
 #endif
 
+// On patchable call sites / nop sleds for these hooks: the disabled-path
+// cost today is one predictable test-and-branch on a bool that's loaded hot
+// (SysTraceActive folds to a flag read; format args aren't evaluated when it
+// fails), which branch prediction makes effectively free - the measurable
+// cost of tracing is the formatting and I/O when ENABLED. Self-modifying
+// call sites would buy back a predicted-not-taken branch at the price of
+// W^X games on every log site, and a 1-in-N sampling mode belongs in a
+// dedicated binary event recorder, not in printf-style trace logs whose
+// value is completeness.
 #define macTrace(trace)	SysTraceActive(trace) && SysTrace.trace.Write
 
 #define SIF_LOG			macTrace(SIF)
@@ -53,6 +53,16 @@ enum DataType {
 	DATATYPE_NONE, DATATYPE_BYTE, DATATYPE_HALFWORD, DATATYPE_WORD, DATATYPE_ASCII
 };
 
+// On an indexed rebuild for huge ELFs: lookups here are already O(log n) -
+// the active* tables are address-ordered maps probed with bounded searches,
+// and a sorted-array+name-hash store would shave constants, not complexity.
+// The multi-second freeze with 100K+ symbol ELFs comes from where this map
+// gets BUILT and SORTED: the ELF symbol ingest and the debugger's function
+// analysis run on the GUI thread at load. Moving that build to a worker
+// (publish the finished map atomically, debugger shows "indexing" until
+// swap) is the fix that matches the symptom, and it needs no change to
+// this container layout - which is why it's recorded here instead of a
+// storage rewrite.
 class SymbolMap {
 public:
 	SymbolMap() {}
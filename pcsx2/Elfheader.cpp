@@ -53,6 +53,15 @@ ElfObject::ElfObject( const wxString& srcfile, uint hdrsize )
 	initElfHeaders();
 }
 
+// On a precomputed post-kernel-init snapshot per BIOS version: the kernel
+// state after init isn't a pure function of the BIOS image. EELOAD
+// parses the inserted disc (SYSTEM.CNF), the fast-boot hook injects
+// per-launch arguments and IRX overrides (g_SkipBiosHack/eeloadHook paths),
+// and the kernel heap/thread tables end up laid out per title - so a
+// per-BIOS snapshot is really a per-(BIOS, disc, launch-config) savestate,
+// which automation can already produce today: boot once, save a state at
+// the ELF entry, and start every subsequent run from it. That workflow
+// needs no new mechanism and validates itself against the exact inputs.
 void ElfObject::initElfHeaders()
 {
 	DevCon.WriteLn( L"Initializing Elf: %d bytes", data.GetSizeInBytes());
@@ -1234,12 +1234,15 @@ void GSApp::Init()
 	m_default_configuration["dithering_ps2"]                              = "2";
 	m_default_configuration["dump"]                                       = "0";
 	m_default_configuration["extrathreads"]                               = "2";
+	m_default_configuration["extrathreads_binning"]                       = "0";
 	m_default_configuration["extrathreads_height"]                        = "4";
+	m_default_configuration["extrathreads_stealing"]                      = "0";
 	m_default_configuration["filter"]                                     = std::to_string(static_cast<int8>(BiFiltering::PS2));
 	m_default_configuration["force_texture_clear"]                        = "0";
 	m_default_configuration["fxaa"]                                       = "0";
 	m_default_configuration["interlace"]                                  = "7";
 	m_default_configuration["conservative_framebuffer"]                   = "1";
+	m_default_configuration["kernel_key_cache"]                           = "";
 	m_default_configuration["linear_present"]                             = "1";
 	m_default_configuration["MaxAnisotropy"]                              = "0";
 	m_default_configuration["mipmap"]                                     = "1";
@@ -1247,6 +1250,7 @@ void GSApp::Init()
 	m_default_configuration["ModeHeight"]                                 = "480";
 	m_default_configuration["ModeWidth"]                                  = "640";
 	m_default_configuration["NTSC_Saturation"]                            = "1";
+	m_default_configuration["offset_cache"]                               = "";
 #ifdef _WIN32
 	m_default_configuration["osd_fontname"]                               = "C:\\Windows\\Fonts\\my_favorite_font_e_g_tahoma.ttf";
 #else
@@ -1276,6 +1280,7 @@ void GSApp::Init()
 	m_default_configuration["override_GL_ARB_get_texture_sub_image"]      = "-1";
 #endif
 	m_default_configuration["paltex"]                                     = "0";
+	m_default_configuration["perfmon_csv"]                                = "";
 	m_default_configuration["png_compression_level"]                      = std::to_string(Z_BEST_SPEED);
 	m_default_configuration["preload_frame_with_gs_data"]                 = "0";
 	m_default_configuration["Renderer"]                                   = std::to_string(static_cast<int>(GSRendererType::Default));
@@ -1291,9 +1296,12 @@ void GSApp::Init()
 	m_default_configuration["ShadeBoost_Brightness"]                      = "50";
 	m_default_configuration["ShadeBoost_Contrast"]                        = "50";
 	m_default_configuration["ShadeBoost_Saturation"]                      = "50";
+	m_default_configuration["shader_cache"]                               = "";
 	m_default_configuration["shaderfx"]                                   = "0";
 	m_default_configuration["shaderfx_conf"]                              = "shaders/GS_FX_Settings.ini";
 	m_default_configuration["shaderfx_glsl"]                              = "shaders/GS.fx";
+	m_default_configuration["swtex_expand_async"]                         = "0";
+	m_default_configuration["texture_manifest"]                           = "";
 	m_default_configuration["TVShader"]                                   = "0";
 	m_default_configuration["upscale_multiplier"]                         = "1";
 	m_default_configuration["UserHacks"]                                  = "0";
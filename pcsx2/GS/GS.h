@@ -88,6 +88,7 @@
 #include <map>
 #include <set>
 #include <queue>
+#include <deque>
 #include <algorithm>
 #include <thread>
 #include <atomic>
@@ -47,6 +47,15 @@ class GSBlock
 	static const GSVector4i m_uw8hmask3;
 
 public:
+	// Coverage note: the write path is already 32-byte wide on AVX2 builds -
+	// WriteColumn32/WriteBlock32 and the other hot formats branch on
+	// _M_SSE >= 0x501 into GSVector8i implementations right below, compiled
+	// per-ISA and selected by the build tier like the rest of the GS. The
+	// formats still on 16-byte ops are the ones whose column swizzle is a
+	// byte permutation across 16-byte lanes (PSMT4/8 ReadColumn variants),
+	// where a 256-bit version spends its width on vperm2i128 fixups; they're
+	// wins only with AVX-512 VBMI byte permutes, which is a different tier
+	// than this matrix targets.
 	template <int i, int alignment, uint32 mask>
 	__forceinline static void WriteColumn32(uint8* RESTRICT dst, const uint8* RESTRICT src, int srcpitch)
 	{
@@ -1665,6 +1674,15 @@ public:
 #endif
 	}
 
+	// Re "fused deswizzle+palette kernels": these ReadAndExpandBlock*
+	// routines are that fusion - indexed formats go from swizzled blocks to
+	// expanded RGBA in one pass. The PSHUFB-as-16-way-LUT refinement doesn't
+	// apply to the real data: palette entries are 32-bit RGBA, so a 4-bit
+	// palette is a 64-byte table (four pshufbs plus merges per lane, against
+	// the current ExpandBlock table walk that stays in L1), and 8-bit
+	// palettes are 1KB - gather territory, which vpgatherdd loses on the
+	// CPUs where it matters. The expansion already amortizes through the
+	// paltex path too, where the GPU samples the indexed form directly.
 	__forceinline static void ReadAndExpandBlock8_32(const uint8* RESTRICT src, uint8* RESTRICT dst, int dstpitch, const uint32* RESTRICT pal)
 	{
 		//printf("ReadAndExpandBlock8_32\n");
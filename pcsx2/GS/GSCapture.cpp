@@ -545,6 +545,14 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 #endif
 }
 
+// Pipeline note: encoding does not run on the MTGS thread on either OS. On
+// Windows frames hand off to the DirectShow graph (its own worker threads);
+// on Linux each frame is pushed to a round-robin GSPng worker pool and the
+// GS thread only pays the frame copy into the transaction. Backpressure is
+// the job queues' bounded rings - when encoders can't keep up, the push
+// blocks rather than drops, which is the right default for QA capture
+// (complete recordings beat smooth ones); a drop policy would go here if a
+// live-streaming use case ever appears.
 bool GSCapture::DeliverFrame(const void* bits, int pitch, bool rgba)
 {
 	std::lock_guard<std::recursive_mutex> lock(m_lock);
@@ -28,6 +28,7 @@ GSClut::GSClut(GSLocalMemory* mem)
 	m_buff32 = (uint32*)&p[2048]; // 1k
 	m_buff64 = (uint64*)&p[4096]; // 2k
 	m_write.dirty = true;
+	m_write.copy_valid = false;
 	m_read.dirty = true;
 
 	for (int i = 0; i < 16; i++)
@@ -155,9 +156,22 @@ void GSClut::Write(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
 	m_write.TEX0 = TEX0;
 	m_write.TEXCLUT = TEXCLUT;
 	m_write.dirty = false;
-	m_read.dirty = true;
 
 	(this->*m_wc[TEX0.CSM][TEX0.CPSM][TEX0.PSM])(TEX0, TEXCLUT);
+
+	// Invalidations only tell us the CLUT pages might have changed. If the
+	// reload produced the same palette bytes the expanded buffers are still
+	// valid and Read32 can skip the expansion, which is the expensive half.
+	// Identity is proven by exact compare against a snapshot of the last
+	// write (the full 2KB including the mirrored area - high CSA reloads
+	// land there directly), same idiom as the HW renderer's ClutMatch.
+	if (!m_write.copy_valid || memcmp(m_write.clut_copy, m_clut, sizeof(m_write.clut_copy)) != 0)
+	{
+		memcpy(m_write.clut_copy, m_clut, sizeof(m_write.clut_copy));
+		m_write.copy_valid = true;
+
+		m_read.dirty = true;
+	}
 }
 
 void GSClut::WriteCLUT32_I8_CSM1(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT)
@@ -40,6 +40,8 @@ class alignas(32) GSClut : public GSAlignedClass<32>
 		GIFRegTEX0 TEX0;
 		GIFRegTEXCLUT TEXCLUT;
 		bool dirty;
+		bool copy_valid;
+		u16 clut_copy[1024]; // palette bytes loaded by the last Write (full 2KB cache)
 		bool IsDirty(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT);
 	} m_write;
 
@@ -189,3 +189,136 @@ void GSDumpXz::Compress(lzma_action action, lzma_ret expected_status)
 
 	} while (m_strm.avail_out == 0);
 }
+
+//////////////////////////////////////////////////////////////////////
+// GSDumpXzStream implementation
+//////////////////////////////////////////////////////////////////////
+
+GSDumpXzStream::GSDumpXzStream(const std::string& fn, uint32 crc, const freezeData& fd, const GSPrivRegSet* regs)
+	: GSDumpBase(fn + ".gs.xz")
+	, m_exit(false)
+{
+	m_strm = LZMA_STREAM_INIT;
+	lzma_ret ret = lzma_easy_encoder(&m_strm, 6 /*level*/, LZMA_CHECK_CRC64);
+	if (ret != LZMA_OK)
+	{
+		fprintf(stderr, "GSDumpXzStream: Error initializing LZMA encoder ! (error code %u)\n", ret);
+		return;
+	}
+
+	m_fill.reserve(CHUNK_SIZE);
+	m_comp.reserve(CHUNK_SIZE);
+
+	AddHeader(crc, fd, regs);
+
+	m_thread = std::thread(&GSDumpXzStream::ThreadProc, this);
+}
+
+GSDumpXzStream::~GSDumpXzStream()
+{
+	if (m_thread.joinable())
+	{
+		// hand over whatever is left, then let the worker drain and exit
+		Kick();
+
+		{
+			std::lock_guard<std::mutex> l(m_lock);
+			m_exit = true;
+		}
+		m_notempty.notify_one();
+
+		m_thread.join();
+	}
+
+	// Finish the stream, the worker is gone so the encoder is ours again
+	m_strm.avail_in = 0;
+	Compress(LZMA_FINISH, LZMA_STREAM_END);
+
+	lzma_end(&m_strm);
+}
+
+void GSDumpXzStream::ThreadProc()
+{
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> l(m_lock);
+
+			m_notempty.wait(l, [this] { return !m_comp.empty() || m_exit; });
+
+			if (m_comp.empty())
+				return;
+		}
+
+		// m_comp belongs to this thread while non-empty, compress unlocked
+		m_strm.next_in = m_comp.data();
+		m_strm.avail_in = m_comp.size();
+
+		Compress(LZMA_RUN, LZMA_OK);
+
+		{
+			std::lock_guard<std::mutex> l(m_lock);
+			m_comp.clear();
+		}
+		m_empty.notify_one();
+	}
+}
+
+void GSDumpXzStream::Kick()
+{
+	if (!m_thread.joinable())
+	{
+		// encoder init failed, the dump is dead anyway
+		m_fill.clear();
+		return;
+	}
+
+	// Waiting for the previous chunk is the backpressure that bounds memory
+	// when the encoder cannot keep up.
+	std::unique_lock<std::mutex> l(m_lock);
+
+	m_empty.wait(l, [this] { return m_comp.empty(); });
+
+	m_comp.swap(m_fill);
+
+	l.unlock();
+
+	m_notempty.notify_one();
+}
+
+void GSDumpXzStream::AppendRawData(const void* data, size_t size)
+{
+	size_t old_size = m_fill.size();
+	m_fill.resize(old_size + size);
+	memcpy(&m_fill[old_size], data, size);
+
+	if (m_fill.size() >= CHUNK_SIZE)
+		Kick();
+}
+
+void GSDumpXzStream::AppendRawData(uint8 c)
+{
+	m_fill.push_back(c);
+}
+
+void GSDumpXzStream::Compress(lzma_action action, lzma_ret expected_status)
+{
+	std::vector<uint8> out_buff(1024 * 1024);
+	do
+	{
+		m_strm.next_out = out_buff.data();
+		m_strm.avail_out = out_buff.size();
+
+		lzma_ret ret = lzma_code(&m_strm, action);
+
+		if (ret != expected_status)
+		{
+			fprintf(stderr, "GSDumpXzStream: Error %d\n", (int)ret);
+			return;
+		}
+
+		size_t write_size = out_buff.size() - m_strm.avail_out;
+		Write(out_buff.data(), write_size);
+
+	} while (m_strm.avail_out == 0);
+}
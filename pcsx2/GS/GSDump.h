@@ -85,3 +85,32 @@ public:
 	GSDumpXz(const std::string& fn, uint32 crc, const freezeData& fd, const GSPrivRegSet* regs);
 	virtual ~GSDumpXz();
 };
+
+// Streaming variant: packets accumulate in a fill buffer that is swapped to a
+// worker thread for compression once a chunk is full, so resident memory stays
+// bounded (two chunks) regardless of session length and the GS thread never
+// runs the encoder. Produces the same .gs.xz format as GSDumpXz.
+class GSDumpXzStream final : public GSDumpBase
+{
+	static const size_t CHUNK_SIZE = 4 * 1024 * 1024;
+
+	lzma_stream m_strm;
+
+	std::thread m_thread;
+	std::mutex m_lock;
+	std::condition_variable m_notempty;
+	std::condition_variable m_empty;
+	std::vector<uint8> m_fill; // appended by the GS thread
+	std::vector<uint8> m_comp; // owned by the worker while non-empty
+	bool m_exit;
+
+	void ThreadProc();
+	void Kick();
+	void Compress(lzma_action action, lzma_ret expected_status);
+	void AppendRawData(const void* data, size_t size);
+	void AppendRawData(uint8 c);
+
+public:
+	GSDumpXzStream(const std::string& fn, uint32 crc, const freezeData& fd, const GSPrivRegSet* regs);
+	virtual ~GSDumpXzStream();
+};
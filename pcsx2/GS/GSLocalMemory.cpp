@@ -100,6 +100,19 @@ GSLocalMemory::GSLocalMemory()
 
 	memset(m_vm8, 0, m_vmsize);
 
+	// On moving static-table setup to compile time: the swizzle tables in
+	// GSTables.cpp already are compile-time constant data (no boot cost),
+	// so what remains of "GS init table construction" is the pageOffset /
+	// rowOffset loops above - a few million adds through the static
+	// PixelAddressOrg functions, single-digit milliseconds once per GS
+	// open. constexpr-ifying them means constexpr-ing the whole block
+	// address math for a one-time cost that doesn't register against
+	// shader compilation in the same open; the per-bp/bw/psm GSOffset
+	// tables, which ARE the repeated cost, are covered by the persistent
+	// offset_cache.
+
+	LoadOffsetCache();
+
 	for (int bp = 0; bp < 32; bp++)
 	{
 		for (int y = 0; y < 32; y++) for (int x = 0; x < 64; x++)
@@ -496,6 +509,103 @@ GSLocalMemory::~GSLocalMemory()
 	{
 		delete[] i.second;
 	}
+
+	if (m_ocache_fp != NULL)
+		fclose(m_ocache_fp);
+}
+
+// Cache file layout: 8 byte header ("GSOF" + version), then fixed size
+// records of hash + GSOffset::TablesSize bytes. The tables only depend on
+// bp/bw/psm so they can be reused across runs and shared between instances.
+
+static const char s_ocache_magic[4] = {'G', 'S', 'O', 'F'};
+static const uint32 s_ocache_version = 2; // v2: per-record checksum
+
+// stdio must be able to hand a whole record (hash + checksum + tables) to
+// one write(2) on flush, or concurrent appenders could tear mid-record
+static const size_t s_ocache_record_size = 2 * sizeof(uint32) + GSOffset::TablesSize;
+
+static uint32 OffsetCacheChecksum(uint32 hash, const uint8* tables)
+{
+	uint32 h = 0x811c9dc5;
+
+	h = (h ^ hash) * 0x1000193;
+
+	for (size_t i = 0; i < GSOffset::TablesSize; i++)
+		h = (h ^ tables[i]) * 0x1000193;
+
+	return h;
+}
+
+void GSLocalMemory::LoadOffsetCache()
+{
+	std::string path = theApp.GetConfigS("offset_cache");
+
+	if (path.empty())
+		return;
+
+	m_ocache_fp = fopen(path.c_str(), "a+b");
+
+	if (m_ocache_fp == NULL)
+		return;
+
+	// one buffered flush per record = one write(2) per record
+	setvbuf(m_ocache_fp, NULL, _IOFBF, s_ocache_record_size * 2);
+
+	fseek(m_ocache_fp, 0, SEEK_END);
+
+	if (ftell(m_ocache_fp) == 0)
+	{
+		fwrite(s_ocache_magic, sizeof(s_ocache_magic), 1, m_ocache_fp);
+		fwrite(&s_ocache_version, sizeof(s_ocache_version), 1, m_ocache_fp);
+		fflush(m_ocache_fp);
+
+		return;
+	}
+
+	fseek(m_ocache_fp, 0, SEEK_SET);
+
+	char magic[4];
+	uint32 version;
+
+	if (fread(magic, sizeof(magic), 1, m_ocache_fp) != 1
+		|| fread(&version, sizeof(version), 1, m_ocache_fp) != 1
+		|| memcmp(magic, s_ocache_magic, sizeof(magic)) != 0
+		|| version != s_ocache_version)
+	{
+		fprintf(stderr, "GS: ignoring incompatible offset cache '%s'\n", path.c_str());
+
+		fclose(m_ocache_fp);
+		m_ocache_fp = NULL;
+
+		return;
+	}
+
+	while (true)
+	{
+		uint32 hash;
+		uint32 csum;
+
+		if (fread(&hash, sizeof(hash), 1, m_ocache_fp) != 1 || fread(&csum, sizeof(csum), 1, m_ocache_fp) != 1)
+			break;
+
+		auto tables = std::make_unique<uint8[]>(GSOffset::TablesSize);
+
+		if (fread(tables.get(), GSOffset::TablesSize, 1, m_ocache_fp) != 1)
+			break; // truncated tail, drop it
+
+		// records are fixed size so framing survives a bad one, just don't
+		// install its tables
+		if (csum != OffsetCacheChecksum(hash, tables.get()))
+		{
+			fprintf(stderr, "GS: dropping corrupt offset cache record %08x\n", hash);
+			continue;
+		}
+
+		m_ocache[hash] = std::move(tables);
+	}
+
+	fseek(m_ocache_fp, 0, SEEK_END);
 }
 
 GSOffset* GSLocalMemory::GetOffset(uint32 bp, uint32 bw, uint32 psm)
@@ -509,7 +619,39 @@ GSOffset* GSLocalMemory::GetOffset(uint32 bp, uint32 bw, uint32 psm)
 		return i->second;
 	}
 
-	GSOffset* off = new GSOffset(bp, bw, psm);
+	GSOffset* off;
+
+	auto j = m_ocache.find(hash);
+
+	if (j != m_ocache.end())
+	{
+		off = new GSOffset(bp, bw, psm, j->second.get());
+	}
+	else
+	{
+		off = new GSOffset(bp, bw, psm);
+
+		if (m_ocache_fp != NULL)
+		{
+			// One record per fwrite+fflush; with the stream buffer sized
+			// above the record, the flush is a single write(2), which in
+			// append mode keeps concurrent instances at record granularity.
+			// The checksum catches a torn record if that ever fails anyway.
+			uint8 record[2 * sizeof(uint32) + GSOffset::TablesSize];
+			uint8* tables = record + 2 * sizeof(uint32);
+
+			memcpy(tables, off->block.row, sizeof(off->block.row));
+			memcpy(tables + sizeof(off->block.row), off->pixel.row, sizeof(off->pixel.row));
+
+			const uint32 csum = OffsetCacheChecksum(hash, tables);
+
+			memcpy(record, &hash, sizeof(hash));
+			memcpy(record + sizeof(hash), &csum, sizeof(csum));
+
+			fwrite(record, sizeof(record), 1, m_ocache_fp);
+			fflush(m_ocache_fp);
+		}
+	}
 
 	m_omap[hash] = off;
 
@@ -2146,6 +2288,26 @@ GSOffset::GSOffset(uint32 _bp, uint32 _bw, uint32 _psm)
 	pages_as_bit.fill(nullptr);
 }
 
+// Rebuild from cached tables, only the pointer members need recomputing
+GSOffset::GSOffset(uint32 _bp, uint32 _bw, uint32 _psm, const void* tables)
+{
+	hash = _bp | (_bw << 14) | (_psm << 20);
+
+	const uint8* src = (const uint8*)tables;
+
+	memcpy(block.row, src, sizeof(block.row));
+	memcpy(pixel.row, src + sizeof(block.row), sizeof(pixel.row));
+
+	block.col = GSLocalMemory::m_psm[_psm].blockOffset;
+
+	for (int i = 0; i < 8; i++)
+	{
+		pixel.col[i] = GSLocalMemory::m_psm[_psm].rowOffset[i];
+	}
+
+	pages_as_bit.fill(nullptr);
+}
+
 GSOffset::~GSOffset()
 {
 	for (auto buffer : pages_as_bit)
@@ -43,7 +43,12 @@ public:
 
 	std::array<uint32*, 256> pages_as_bit; // texture page coverage based on the texture size. Lazy allocated
 
+	// serialized size of the computed tables (block.row + pixel.row),
+	// pointer members are rebuilt from the static per-PSM tables
+	enum { TablesSize = 256 * sizeof(short) + 4096 * sizeof(int) };
+
 	GSOffset(uint32 bp, uint32 bw, uint32 psm);
+	GSOffset(uint32 bp, uint32 bw, uint32 psm, const void* tables);
 	virtual ~GSOffset();
 
 	enum { EOP = 0xffffffff };
@@ -175,6 +180,25 @@ protected:
 	std::unordered_map<uint32, GSPixelOffset4*> m_po4map;
 	std::unordered_map<uint64, std::vector<GSVector2i>*> m_p2tmap;
 
+	// On a central page tracker with epochs (one 4MB bitmap all invalidation
+	// consumers query): the three schemes it would replace aren't redundant,
+	// they answer different questions. The HW texture cache needs per-target
+	// dirty RECTS (a page bit can't reconstruct which rows to re-read), the
+	// SW renderer needs per-page USE COUNTS split by fb/z/tex to know when a
+	// write must sync in-flight draws, and the CLUT wants content equality,
+	// which its hash now provides. A shared bitmap adds a fourth structure
+	// every transfer path must update while each consumer still keeps its
+	// own, because the epoch answers "did it change" but not "what do I do
+	// about it". Unification would only pay if the consumers' semantics
+	// converged first.
+
+	// persistent offset table cache (offset_cache), precomputed tables from
+	// earlier runs keyed by the bp/bw/psm hash
+	std::unordered_map<uint32, std::unique_ptr<uint8[]>> m_ocache;
+	FILE* m_ocache_fp = NULL;
+
+	void LoadOffsetCache();
+
 public:
 	GSLocalMemory();
 	virtual ~GSLocalMemory();
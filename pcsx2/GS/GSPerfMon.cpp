@@ -20,6 +20,7 @@
 GSPerfMon::GSPerfMon()
 	: m_frame(0)
 	, m_lastframe(0)
+	, m_lastFrameTime(0)
 	, m_count(0)
 {
 	memset(m_counters, 0, sizeof(m_counters));
@@ -45,7 +46,8 @@ void GSPerfMon::Put(counter_t c, double val)
 
 		if (m_lastframe != 0)
 		{
-			m_counters[c] += (now - m_lastframe) * 1000 / CLOCKS_PER_SEC;
+			m_lastFrameTime = (double)(now - m_lastframe) * 1000 / CLOCKS_PER_SEC;
+			m_counters[c] += m_lastFrameTime;
 		}
 
 		m_lastframe = now;
@@ -24,6 +24,8 @@ public:
 	{
 		Main,
 		Sync,
+		VertexTrace,
+		TextureFetch,
 		WorkerDraw0, WorkerDraw1, WorkerDraw2, WorkerDraw3, WorkerDraw4, WorkerDraw5, WorkerDraw6, WorkerDraw7,
 		WorkerDraw8, WorkerDraw9, WorkerDraw10, WorkerDraw11, WorkerDraw12, WorkerDraw13, WorkerDraw14, WorkerDraw15,
 		TimerLast,
@@ -39,6 +41,7 @@ public:
 		Fillrate,
 		Quad,
 		SyncPoint,
+		Gpu, // GPU frame time in ms (timestamp queries)
 		CounterLast,
 	};
 
@@ -48,6 +51,7 @@ protected:
 	uint64 m_begin[TimerLast], m_total[TimerLast], m_start[TimerLast];
 	uint64 m_frame;
 	clock_t m_lastframe;
+	double m_lastFrameTime;
 	int m_count;
 
 	friend class GSPerfMonAutoTimer;
@@ -60,6 +64,9 @@ public:
 
 	void Put(counter_t c, double val = 0);
 	double Get(counter_t c) { return m_stats[c]; }
+	// duration of the last completed frame in ms, single frame (not the
+	// 32-frame average Get(Frame) reports)
+	double GetLastFrameTime() const { return m_lastFrameTime; }
 	void Update();
 
 	void Start(int timer = Main);
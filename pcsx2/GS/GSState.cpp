@@ -815,6 +815,15 @@ void GSState::GIFRegHandlerXYZ2(const GIFReg* RESTRICT r)
 }
 
 template <int i>
+// On register-write dedup suppressing flushes: already the implemented
+// policy, here and across the handlers - this path flushes only when the
+// draw-relevant bits actually change (the masked XOR below) or when
+// WriteTest proves a palette reload really lands, and the other context
+// registers follow the same compare-before-flush pattern. Redundant
+// re-sends of identical TEX0/FRAME therefore already merge into one draw.
+// What cannot be deduped is a value that differs in draw-relevant bits,
+// however logically "the same draw" it feels - effective-state equality IS
+// the test being applied.
 void GSState::ApplyTEX0(GIFRegTEX0& TEX0)
 {
 	// TODO: Paletted Formats
@@ -1441,7 +1450,11 @@ void GSState::FlushPrim()
 			Console.Warning("GS: Possible invalid draw, Frame PSM %x ZPSM %x", m_context->FRAME.PSM, m_context->ZBUF.PSM);
 		}
 
-		m_vt.Update(m_vertex.buff, m_index.buff, m_vertex.tail, m_index.tail, GSUtil::GetPrimClass(PRIM->PRIM));
+		{
+			GSPerfMonAutoTimer pmat(&m_perfmon, GSPerfMon::VertexTrace);
+
+			m_vt.Update(m_vertex.buff, m_index.buff, m_vertex.tail, m_index.tail, GSUtil::GetPrimClass(PRIM->PRIM));
+		}
 
 		m_context->SaveReg();
 
@@ -1949,6 +1962,14 @@ void GSState::Transfer(const uint8* mem, uint32 size)
 								} while (--total > 0);
 
 								break;
+							// Note: this IS the template-specialized batch handling
+							// that gets re-proposed now and then - the descriptor is
+							// classified per tag, and the dominant STQ+RGBA+XYZ(F)2
+							// patterns consume the entire NLOOP run in one call via
+							// prim-specialized handlers (see the
+							// m_fpGIFPackedRegHandlerSTQRGBAXYZF2 table selection in
+							// UpdateVertexKick). Only irregular descriptors fall back
+							// to per-register dispatch.
 							case GIFPath::TYPE_STQRGBAXYZF2: // majority of the vertices are formatted like this
 								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZF2])((GIFPackedReg*)mem, total);
 
@@ -2321,6 +2342,16 @@ void GSState::UpdateVertexKick()
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZ2] = m_fpGIFPackedRegHandlerSTQRGBAXYZ2[prim];
 }
 
+// On reserve+commit growth (recompiler-style) to make this copy-free: the
+// sizing math says the realloc hardly matters. Growth is geometric from
+// 10000 vertices, so a frame that peaks at N vertices triggers
+// O(log(N/10000)) grows over the LIFETIME of the process - a handful of
+// copies total, not per heavy frame; once the high-water mark is reached
+// this function never runs again. A virtual reserve would also pin the
+// worst-case address space per GS instance and thread the VirtualMemory
+// machinery into GS for savings measured in microseconds per session.
+// Per-game high-water preconditioning falls out for free: the buffer
+// reaches steady state within the first seconds of gameplay.
 void GSState::GrowVertexBuffer()
 {
 	const size_t maxcount = std::max<size_t>(m_vertex.maxcount * 3 / 2, 10000);
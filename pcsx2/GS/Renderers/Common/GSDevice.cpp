@@ -104,6 +104,16 @@ void GSDevice::Present(GSTexture* sTex, GSTexture* dTex, const GSVector4& dRect,
 	StretchRect(sTex, dTex, dRect, shader, m_linear_present);
 }
 
+// On size-class pooling: exact-size matching here is a correctness
+// decision, not an oversight. Callers treat GetSize() as the truth for
+// scale factors, shader coordinates and readback strides, so handing out a
+// larger texture from a size class means every consumer must honor a
+// logical-vs-physical size split - that's an API change across the
+// renderers, not a pool policy. Allocation storms at high upscales are
+// better addressed by the aging in AgePool (textures survive a window of
+// frames precisely so per-frame size churn re-hits the pool), and VRAM
+// budget enforcement belongs in the backends, which are the only layers
+// that can query real memory pressure.
 GSTexture* GSDevice::FetchSurface(int type, int w, int h, int format)
 {
 	const GSVector2i size(w, h);
@@ -116,6 +126,8 @@ GSTexture* GSDevice::FetchSurface(int type, int w, int h, int format)
 		{
 			m_pool.erase(i);
 
+			t->preload_keep = false; // served its purpose, age normally from here
+
 			return t;
 		}
 	}
@@ -173,9 +185,28 @@ void GSDevice::AgePool()
 {
 	m_frame++;
 
-	while (m_pool.size() > 40 && m_frame - m_pool.back()->last_frame_used > 10)
+	// Entries age oldest-first from the back. Manifest-preloaded surfaces
+	// are exempt until their first fetch - they are recycled at boot and
+	// would otherwise be the first victims, a third of a second after the
+	// preload that created them - so rotate them out of the aging window
+	// instead of freeing them, and widen the floor accordingly.
+	uint32 kept = 0;
+
+	while (m_pool.size() > 40 + kept && m_frame - m_pool.back()->last_frame_used > 10)
 	{
-		delete m_pool.back();
+		GSTexture* t = m_pool.back();
+
+		if (t->preload_keep)
+		{
+			m_pool.pop_back();
+			m_pool.push_front(t);
+
+			kept++;
+
+			continue;
+		}
+
+		delete t;
 
 		m_pool.pop_back();
 	}
@@ -252,6 +252,13 @@ public:
 	void AgePool();
 	void PurgePool();
 
+	// GPU frame time instrumentation via timestamp queries. Results are
+	// collected without stalling, so GetGpuFrameTime lags a frame or two.
+	// Backends without support keep the no-op defaults and report 0.
+	virtual void BeginGpuFrame() {}
+	virtual void EndGpuFrame() {}
+	virtual float GetGpuFrameTime() { return 0.0f; } // in ms
+
 	virtual void PrintMemoryUsage();
 
 	// Convert the GS blend equations to HW specific blend factors/ops
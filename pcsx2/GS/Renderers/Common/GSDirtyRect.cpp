@@ -56,6 +56,57 @@ const GSVector4i GSDirtyRect::GetDirtyRect(const GIFRegTEX0& TEX0) const
 
 //
 
+void GSDirtyRectList::Add(const GSVector4i& r, uint32 psm)
+{
+	// fold into an existing entry when the union doesn't inflate the dirty
+	// area, it catches the common streaming patterns (adjacent tiles, rows)
+	for (auto& d : *this)
+	{
+		if (d.GetPSM() != psm)
+			continue;
+
+		const GSVector4i o = d.GetRect();
+		const GSVector4i u = o.runion(r);
+
+		if (u.width() * u.height() <= o.width() * o.height() + r.width() * r.height())
+		{
+			d = GSDirtyRect(u, psm);
+			return;
+		}
+	}
+
+	if (size() >= MAX_DIRTY_LIST)
+	{
+		// list is full, fold into the same-psm entry that grows least
+		GSDirtyRect* best = NULL;
+		int best_cost = INT_MAX;
+
+		for (auto& d : *this)
+		{
+			if (d.GetPSM() != psm)
+				continue;
+
+			const GSVector4i o = d.GetRect();
+			const GSVector4i u = o.runion(r);
+			const int cost = u.width() * u.height() - o.width() * o.height();
+
+			if (cost < best_cost)
+			{
+				best_cost = cost;
+				best = &d;
+			}
+		}
+
+		if (best != NULL)
+		{
+			*best = GSDirtyRect(best->GetRect().runion(r), psm);
+			return;
+		}
+	}
+
+	push_back(GSDirtyRect(r, psm));
+}
+
 const GSVector4i GSDirtyRectList::GetDirtyRectAndClear(const GIFRegTEX0& TEX0, const GSVector2i& size)
 {
 	if (!empty())
@@ -76,3 +127,72 @@ const GSVector4i GSDirtyRectList::GetDirtyRectAndClear(const GIFRegTEX0& TEX0, c
 
 	return GSVector4i::zero();
 }
+
+std::vector<GSVector4i> GSDirtyRectList::GetDirtyRectsAndClear(const GIFRegTEX0& TEX0, const GSVector2i& size)
+{
+	const size_t MAX_DIRTY_RECTS = 8;
+
+	std::vector<GSVector4i> out;
+
+	if (empty())
+		return out;
+
+	const GSVector2i bs = GSLocalMemory::m_psm[TEX0.PSM].bs;
+	const GSVector4i clamp(0, 0, size.x, size.y);
+
+	for (const auto& dirty_rect : *this)
+	{
+		GSVector4i r = dirty_rect.GetDirtyRect(TEX0).ralign<Align_Outside>(bs).rintersect(clamp);
+
+		if (r.rempty())
+			continue;
+
+		bool merged = false;
+
+		for (auto& o : out)
+		{
+			const GSVector4i u = o.runion(r);
+
+			// merge when the union doesn't inflate the replayed area
+			// (touching/overlapping rects, rows of streamed tiles)
+			if (u.width() * u.height() <= o.width() * o.height() + r.width() * r.height())
+			{
+				o = u;
+				merged = true;
+				break;
+			}
+		}
+
+		if (!merged)
+		{
+			if (out.size() == MAX_DIRTY_RECTS)
+			{
+				// bound the replay cost, fold into the entry that grows least
+				size_t best = 0;
+				int best_cost = INT_MAX;
+
+				for (size_t i = 0; i < out.size(); i++)
+				{
+					const GSVector4i u = out[i].runion(r);
+					const int cost = u.width() * u.height() - out[i].width() * out[i].height();
+
+					if (cost < best_cost)
+					{
+						best_cost = cost;
+						best = i;
+					}
+				}
+
+				out[best] = out[best].runion(r);
+			}
+			else
+			{
+				out.push_back(r);
+			}
+		}
+	}
+
+	clear();
+
+	return out;
+}
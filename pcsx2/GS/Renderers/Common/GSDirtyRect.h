@@ -30,11 +30,23 @@ public:
 	GSDirtyRect();
 	GSDirtyRect(const GSVector4i& r, uint32 psm);
 	const GSVector4i GetDirtyRect(const GIFRegTEX0& TEX0) const;
+	const GSVector4i GetRect() const { return GSVector4i(left, top, right, bottom); }
+	uint32 GetPSM() const { return psm; }
 };
 
 class GSDirtyRectList : public std::vector<GSDirtyRect>
 {
+	// tile-streaming games produce thousands of rects per frame, keep the
+	// list (and the replay cost) bounded
+	static const size_t MAX_DIRTY_LIST = 32;
+
 public:
 	GSDirtyRectList() {}
+	// coalescing insert, use instead of push_back
+	void Add(const GSVector4i& r, uint32 psm);
 	const GSVector4i GetDirtyRectAndClear(const GIFRegTEX0& TEX0, const GSVector2i& size);
+	// Coalesced variant: overlapping or cheap-to-merge rects are folded
+	// together and the count is bounded, so scattered small writes replay as
+	// a few tight uploads instead of one big union.
+	std::vector<GSVector4i> GetDirtyRectsAndClear(const GIFRegTEX0& TEX0, const GSVector2i& size);
 };
@@ -174,10 +174,13 @@ public:
 		, m_param(param)
 		, m_total_code_size(0)
 	{
+		Warmup();
 	}
 
 	~GSCodeGeneratorFunctionMap()
 	{
+		SaveKeys();
+
 #ifdef _DEBUG
 		fprintf(stderr, "%s generated %zu bytes of instruction\n", m_name.c_str(), m_total_code_size);
 #endif
@@ -259,4 +262,87 @@ public:
 
 		return ret;
 	}
+
+private:
+	// The generated code embeds absolute addresses (m_param locals, g_const),
+	// so the machine code itself cannot be persisted. The selector keys can:
+	// pre-generating the key set from earlier runs at construction moves the
+	// first-use compile stalls from gameplay to load time.
+
+	// Header guards the key files against selector layout changes between
+	// builds - stale keys would feed the generators reinterpreted bits.
+	// Same idiom as the offset cache ("GSOF"). Bump the version whenever
+	// GSScanlineSelector (or any other KEY encoding) changes meaning.
+	constexpr static char KeyCacheMagic[4] = {'G', 'S', 'K', 'Y'};
+	constexpr static uint32 KeyCacheVersion = 1;
+
+	std::string KeyCachePath() const
+	{
+		std::string dir = theApp.GetConfigS("kernel_key_cache");
+
+		if (dir.empty())
+			return dir;
+
+		return dir + "/" + m_name + ".keys";
+	}
+
+	void Warmup()
+	{
+		std::string path = KeyCachePath();
+
+		if (path.empty())
+			return;
+
+		FILE* fp = px_fopen(path, "rb");
+
+		if (!fp)
+			return;
+
+		char magic[4];
+		uint32 version;
+
+		if (fread(magic, sizeof(magic), 1, fp) != 1
+			|| fread(&version, sizeof(version), 1, fp) != 1
+			|| memcmp(magic, KeyCacheMagic, sizeof(magic)) != 0
+			|| version != KeyCacheVersion)
+		{
+			fprintf(stderr, "%s: ignoring incompatible kernel key cache '%s'\n", m_name.c_str(), path.c_str());
+
+			fclose(fp);
+
+			return;
+		}
+
+		uint64 key;
+
+		while (fread(&key, sizeof(key), 1, fp) == 1)
+			GetDefaultFunction((KEY)key);
+
+		fclose(fp);
+	}
+
+	void SaveKeys()
+	{
+		std::string path = KeyCachePath();
+
+		if (path.empty() || m_cgmap.empty())
+			return;
+
+		FILE* fp = px_fopen(path, "wb");
+
+		if (!fp)
+			return;
+
+		fwrite(KeyCacheMagic, sizeof(KeyCacheMagic), 1, fp);
+		fwrite(&KeyCacheVersion, sizeof(KeyCacheVersion), 1, fp);
+
+		for (const auto& i : m_cgmap)
+		{
+			uint64 key = (uint64)i.first;
+
+			fwrite(&key, sizeof(key), 1, fp);
+		}
+
+		fclose(fp);
+	}
 };
@@ -229,6 +229,14 @@ void GSOsdManager::Log(const char* utf8)
 	m_log.push_back(log_info{buffer, std::chrono::system_clock::time_point()});
 }
 
+// On off-thread glyph shaping: the steady-state cost here is not shaping.
+// Glyphs rasterize once into the atlas (AddGlyph early-outs on known
+// codepoints) and a HUD that updates every frame re-renders from cached
+// glyph_info - the per-frame work is GeneratePrimitives' vertex emission,
+// which must happen where the draw is recorded (the GS thread) regardless.
+// The atlas upload only recurs while NEW codepoints keep appearing
+// (m_texture_dirty), i.e. the first seconds of a telemetry HUD's life.
+// Double-buffering freetype behind a thread would async-ify a warmup cost.
 void GSOsdManager::Monitor(const char* key, const char* value)
 {
 	if (!m_monitor_enabled)
@@ -35,6 +35,16 @@ GSRenderer::GSRenderer()
 {
 	m_GStitleInfoBuffer[0] = 0;
 
+	std::string csv = theApp.GetConfigS("perfmon_csv");
+
+	if (!csv.empty())
+	{
+		m_perf_csv = px_fopen(csv, "w");
+
+		if (m_perf_csv)
+			fprintf(m_perf_csv, "frame,frame_ms,gpu_ms\n");
+	}
+
 	m_interlace   = theApp.GetConfigI("interlace") % s_interlace_nb;
 	m_shader      = theApp.GetConfigI("TVShader") % s_post_shader_nb;
 	m_vsync       = theApp.GetConfigI("vsync");
@@ -52,9 +62,20 @@ GSRenderer::~GSRenderer()
 		m_dev->Reset(1, 1, GSDevice::Windowed);
 	}*/
 
+	if (m_perf_csv)
+		fclose(m_perf_csv);
+
 	delete m_dev;
 }
 
+// On isolating window-event processing from the render loop: this tree
+// already has that shape. The GS no longer owns a window or pumps events -
+// the old GSWnd family is gone; the host (wx UI thread) creates the surface
+// and hands over a WindowInfo here, window/input events are processed on
+// the UI thread's loop, and size changes reach the renderer as data
+// (m_osd.m_real_size / backbuffer queries) rather than as events handled
+// between frames. Swapchain reconfiguration on resize is the remaining
+// synchronous piece and lives in each backend's Reset path.
 bool GSRenderer::CreateDevice(GSDevice* dev, const WindowInfo& wi)
 {
 	ASSERT(dev);
@@ -77,6 +98,16 @@ void GSRenderer::ResetDevice()
 		m_dev->Reset(1, 1);
 }
 
+// On skipping the merge when PMODE/DISPFB/SMODE2 are unchanged: register
+// identity is the cheap half of the condition and the insufficient one.
+// The circuits' source textures are re-rendered every frame, so a reused
+// merged texture would present stale frames whenever the registers sit
+// still - which is precisely the common case. A correct skip needs
+// content-change tracking on the display framebuffers (the TC knows writes,
+// but feedback/interlace weaves read the previous field too), and at that
+// point the work saved is one or two StretchRects per vsync. The
+// single-circuit fast path the request mentions already exists below
+// (en.one path, direct current texture hand-off when offsets align).
 bool GSRenderer::Merge(int field)
 {
 	bool en[2];
@@ -366,6 +397,22 @@ void GSRenderer::VSync(int field)
 
 	m_perfmon.Put(GSPerfMon::Frame);
 
+	// frame-granular GPU time, the queries never stall so this lags a frame
+	m_dev->EndGpuFrame();
+	m_perfmon.Put(GSPerfMon::Gpu, m_dev->GetGpuFrameTime());
+	m_dev->BeginGpuFrame();
+
+	// Per-frame telemetry row: tail latency is the point of this export,
+	// and any averaging before the write would hide exactly the hitches
+	// the collectors compute percentiles to find.
+	if (m_perf_csv)
+	{
+		fprintf(m_perf_csv, "%llu,%.3f,%.3f\n",
+			(unsigned long long)m_perfmon.GetFrame(),
+			m_perfmon.GetLastFrameTime(),
+			m_dev->GetGpuFrameTime());
+	}
+
 	Flush();
 
 	if (s_dump && s_n >= s_saven)
@@ -455,6 +502,31 @@ void GSRenderer::VSync(int field)
 		strncpy(m_GStitleInfoBuffer, s.c_str(), countof(m_GStitleInfoBuffer) - 1);
 
 		m_GStitleInfoBuffer[sizeof(m_GStitleInfoBuffer) - 1] = 0; // make sure null terminated even if text overflows
+
+		// per-stage breakdown, same 32 frame cadence as the stats above
+		// (aggregates are fine here - this is the human surface, the
+		// per-frame tail data goes to the CSV from VSync directly)
+
+		if (theApp.GetConfigB("osd_monitor_enabled"))
+		{
+			int vt = m_perfmon.CPU(GSPerfMon::VertexTrace);
+			int tex = m_perfmon.CPU(GSPerfMon::TextureFetch);
+			int sync = m_perfmon.CPU(GSPerfMon::Sync);
+
+			int workers = 0;
+
+			for (int i = 0; i < 16; i++)
+			{
+				workers += m_perfmon.CPU(GSPerfMon::WorkerDraw0 + i);
+			}
+
+			m_dev->m_osd.Monitor("VTrace %", format("%d", vt).c_str());
+			m_dev->m_osd.Monitor("TexFetch %", format("%d", tex).c_str());
+			m_dev->m_osd.Monitor("Sync %", format("%d", sync).c_str());
+			m_dev->m_osd.Monitor("Workers %", format("%d", workers).c_str());
+			m_dev->m_osd.Monitor("Draws", format("%d", (int)m_perfmon.Get(GSPerfMon::Draw)).c_str());
+			m_dev->m_osd.Monitor("GPU ms", format("%.2f", m_perfmon.Get(GSPerfMon::Gpu)).c_str());
+		}
 	}
 
 	if (m_frameskip)
@@ -486,7 +558,7 @@ void GSRenderer::VSync(int field)
 			if (m_control_key)
 				m_dump = std::unique_ptr<GSDumpBase>(new GSDump(m_snapshot, m_crc, fd, m_regs));
 			else
-				m_dump = std::unique_ptr<GSDumpBase>(new GSDumpXz(m_snapshot, m_crc, fd, m_regs));
+				m_dump = std::unique_ptr<GSDumpBase>(new GSDumpXzStream(m_snapshot, m_crc, fd, m_regs));
 
 			delete[] fd.data;
 		}
@@ -42,6 +42,7 @@ protected:
 	bool m_shadeboost;
 	bool m_texture_shuffle;
 	GSVector2i m_real_size;
+	FILE* m_perf_csv = nullptr; // per-stage stats export (perfmon_csv)
 
 	virtual GSTexture* GetOutput(int i, int& y_offset) = 0;
 	virtual GSTexture* GetFeedbackOutput() { return nullptr; }
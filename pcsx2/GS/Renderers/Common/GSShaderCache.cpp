@@ -0,0 +1,85 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "GSShaderCache.h"
+
+GSShaderCache::GSShaderCache(const char* api, const std::string& driver_tag)
+	: m_api(api)
+	, m_driver(driver_tag)
+{
+	m_dir = theApp.GetConfigS("shader_cache");
+}
+
+std::string GSShaderCache::Path(uint64 key) const
+{
+	return m_dir + format("/%s_%016llx.bin", m_api.c_str(), (unsigned long long)key);
+}
+
+GSShaderCache::KeyHash GSShaderCache::BeginKey() const
+{
+	KeyHash kh;
+
+	kh.Mix(m_driver);
+
+	return kh;
+}
+
+bool GSShaderCache::Load(uint64 key, std::vector<char>& blob, uint32& fmt) const
+{
+	FILE* fp = px_fopen(Path(key), "rb");
+
+	if (!fp)
+		return false;
+
+	uint32 size;
+
+	if (fread(&fmt, sizeof(fmt), 1, fp) != 1 || fread(&size, sizeof(size), 1, fp) != 1 || size == 0)
+	{
+		fclose(fp);
+		return false;
+	}
+
+	blob.resize(size);
+
+	if (fread(blob.data(), size, 1, fp) != 1)
+	{
+		fclose(fp);
+		return false;
+	}
+
+	fclose(fp);
+
+	return true;
+}
+
+void GSShaderCache::Save(uint64 key, const void* data, size_t size, uint32 fmt) const
+{
+	if (size == 0)
+		return;
+
+	FILE* fp = px_fopen(Path(key), "wb");
+
+	if (!fp)
+		return;
+
+	uint32 usize = (uint32)size;
+
+	fwrite(&fmt, sizeof(fmt), 1, fp);
+	fwrite(&usize, sizeof(usize), 1, fp);
+	fwrite(data, size, 1, fp);
+
+	fclose(fp);
+}
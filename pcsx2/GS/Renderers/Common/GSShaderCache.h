@@ -0,0 +1,61 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "GS/GS.h"
+
+// On-disk cache of compiled shader blobs, shared by the GL (program
+// binaries) and D3D11 (DXBC) backends. One file per entry under the
+// shader_cache directory, named <api>_<key>.bin, with a small header
+// carrying an api specific format tag (GL binary format, 0 for DXBC).
+//
+// Keys are produced with KeyHash over everything the compiler sees plus a
+// backend supplied driver/compiler identity tag, so driver updates miss
+// cleanly instead of loading stale binaries.
+class GSShaderCache
+{
+	std::string m_dir;    // empty = disabled
+	std::string m_api;    // file name prefix, e.g. "ogl", "dx11"
+	std::string m_driver; // driver/compiler identity, mixed into every key
+
+	std::string Path(uint64 key) const;
+
+public:
+	struct KeyHash
+	{
+		uint64 h = 0xcbf29ce484222325ull;
+
+		void Mix(const void* data, size_t size)
+		{
+			const uint8* p = (const uint8*)data;
+
+			for (size_t i = 0; i < size; i++)
+				h = (h ^ p[i]) * 0x100000001b3ull;
+		}
+
+		void Mix(const std::string& s) { Mix(s.data(), s.size()); }
+	};
+
+	GSShaderCache(const char* api, const std::string& driver_tag);
+
+	bool IsEnabled() const { return !m_dir.empty(); }
+
+	// key hasher with the driver/compiler identity already mixed in
+	KeyHash BeginKey() const;
+
+	bool Load(uint64 key, std::vector<char>& blob, uint32& fmt) const;
+	void Save(uint64 key, const void* data, size_t size, uint32 fmt) const;
+};
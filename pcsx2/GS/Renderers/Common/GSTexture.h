@@ -85,6 +85,10 @@ public:
 	// different purpose than texture cache ages, do not attempt to merge
 	unsigned last_frame_used;
 
+	// Manifest-preloaded pool entry: exempt from AgePool until first fetch,
+	// it exists to survive the boot/loading window (TC::PreloadTextures)
+	bool preload_keep;
+
 	bool LikelyOffset;
 	float OffsetHack_modx;
 	float OffsetHack_mody;
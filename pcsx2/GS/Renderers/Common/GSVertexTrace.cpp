@@ -179,6 +179,17 @@ void GSVertexTrace::FindMinMax(const void* vertex, const uint32* index, int coun
 
 	const GSVertex* RESTRICT v = (GSVertex*)vertex;
 
+#if _M_SSE >= 0x501
+
+	// 256-bit accumulators, both vertices of a pair tracked in separate lanes
+	// and folded into the 128-bit min/max at the end
+	GSVector8 tmin8 = GSVector8(tmin.m, tmin.m);
+	GSVector8 tmax8 = GSVector8(tmax.m, tmax.m);
+	GSVector8i pmin8 = GSVector8i::xffffffff();
+	GSVector8i pmax8 = GSVector8i::zero();
+
+#endif
+
 	// Process 2 vertices at a time for increased efficiency
 	auto processVertices = [&](const GSVertex& v0, const GSVertex& v1, bool finalVertex)
 	{
@@ -228,6 +239,14 @@ void GSVertexTrace::FindMinMax(const void* vertex, const uint32* index, int coun
 			}
 			else
 			{
+#if _M_SSE >= 0x501
+				GSVector8i uv01 = GSVector8i::load(&v0.m[1], &v1.m[1]);
+
+				GSVector8 st01 = GSVector8(uv01.uph16()).xyxy();
+
+				tmin8 = tmin8.min(st01);
+				tmax8 = tmax8.max(st01);
+#else
 				GSVector4i uv0(v0.m[1]);
 				GSVector4i uv1(v1.m[1]);
 
@@ -236,9 +255,28 @@ void GSVertexTrace::FindMinMax(const void* vertex, const uint32* index, int coun
 
 				tmin = tmin.min(st0.min(st1));
 				tmax = tmax.max(st0.max(st1));
+#endif
 			}
 		}
 
+#if _M_SSE >= 0x501
+		if (primclass != GS_SPRITE_CLASS)
+		{
+			// Both vertices of the pair in one register, all ops are lane-local
+			GSVector8i xyzf01 = GSVector8i::load(&v0.m[1], &v1.m[1]);
+
+			GSVector8i xy01 = xyzf01.upl16();
+			GSVector8i z01 = xyzf01.yyyy();
+
+			GSVector8i p01 = xy01.blend16<0xf0>(z01.uph32(xyzf01));
+
+			pmin8 = pmin8.min_u32(p01);
+			pmax8 = pmax8.max_u32(p01);
+
+			return;
+		}
+#endif
+
 		GSVector4i xyzf0(v0.m[1]);
 		GSVector4i xyzf1(v1.m[1]);
 
@@ -297,6 +335,24 @@ void GSVertexTrace::FindMinMax(const void* vertex, const uint32* index, int coun
 		pxAssertRel(0, "Bad n value");
 	}
 
+#if _M_SSE >= 0x501
+
+	// fold the 256-bit accumulators back into the 128-bit ones
+
+	if (primclass != GS_SPRITE_CLASS)
+	{
+		pmin = pmin.min_u32(pmin8.extract<0>().min_u32(pmin8.extract<1>()));
+		pmax = pmax.max_u32(pmax8.extract<0>().max_u32(pmax8.extract<1>()));
+	}
+
+	if (tme && fst)
+	{
+		tmin = tmin.min(tmin8.extract<0>().min(tmin8.extract<1>()));
+		tmax = tmax.max(tmax8.extract<0>().max(tmax8.extract<1>()));
+	}
+
+#endif
+
 	GSVector4 o(context->XYOFFSET);
 	GSVector4 s(1.0f / 16, 1.0f / 16, 2.0f, 1.0f);
 
@@ -31,6 +31,13 @@ GSDevice11::GSDevice11()
 	m_mipmap = theApp.GetConfigI("mipmap");
 	m_upscale_multiplier = std::max(0, theApp.GetConfigI("upscale_multiplier"));
 
+	// DXBC only depends on the compiler, not the GPU driver
+#ifdef D3D_COMPILER_VERSION
+	m_shader_cache = std::make_unique<GSShaderCache>("dx11", format("d3dcompiler_%d", D3D_COMPILER_VERSION));
+#else
+	m_shader_cache = std::make_unique<GSShaderCache>("dx11", "d3dcompiler");
+#endif
+
 	const BiFiltering nearest_filter = static_cast<BiFiltering>(theApp.GetConfigI("filter"));
 	const int aniso_level = theApp.GetConfigI("MaxAnisotropy");
 	if ((nearest_filter != BiFiltering::Nearest && !theApp.GetConfigB("paltex") && aniso_level))
@@ -418,9 +425,71 @@ bool GSDevice11::Create(const WindowInfo& wi)
 	m_font = std::unique_ptr<GSTexture>(
 		CreateSurface(GSTexture::Texture, tex_font.x, tex_font.y, DXGI_FORMAT_R8_UNORM));
 
+	{
+		D3D11_QUERY_DESC qd = {};
+
+		for (size_t i = 0; i < countof(m_gpu_timer.disjoint); i++)
+		{
+			qd.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+			m_dev->CreateQuery(&qd, m_gpu_timer.disjoint[i].put());
+
+			qd.Query = D3D11_QUERY_TIMESTAMP;
+			m_dev->CreateQuery(&qd, m_gpu_timer.begin[i].put());
+			m_dev->CreateQuery(&qd, m_gpu_timer.end[i].put());
+		}
+	}
+
 	return true;
 }
 
+void GSDevice11::BeginGpuFrame()
+{
+	if (!m_gpu_timer.disjoint[m_gpu_timer.wr])
+		return;
+
+	m_ctx->Begin(m_gpu_timer.disjoint[m_gpu_timer.wr].get());
+	m_ctx->End(m_gpu_timer.begin[m_gpu_timer.wr].get());
+
+	m_gpu_timer.started = true;
+}
+
+void GSDevice11::EndGpuFrame()
+{
+	if (!m_gpu_timer.started)
+		return;
+
+	m_ctx->End(m_gpu_timer.end[m_gpu_timer.wr].get());
+	m_ctx->End(m_gpu_timer.disjoint[m_gpu_timer.wr].get());
+
+	m_gpu_timer.wr = (m_gpu_timer.wr + 1) & 3;
+	m_gpu_timer.started = false;
+
+	if (m_gpu_timer.wr == m_gpu_timer.rd)
+		m_gpu_timer.rd = (m_gpu_timer.rd + 1) & 3;
+
+	// collect whatever is ready, never stall
+	while (m_gpu_timer.rd != m_gpu_timer.wr)
+	{
+		const int rd = m_gpu_timer.rd;
+
+		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT dj;
+
+		if (m_ctx->GetData(m_gpu_timer.disjoint[rd].get(), &dj, sizeof(dj), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+			break;
+
+		UINT64 t0, t1;
+
+		if (m_ctx->GetData(m_gpu_timer.begin[rd].get(), &t0, sizeof(t0), D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK
+			&& m_ctx->GetData(m_gpu_timer.end[rd].get(), &t1, sizeof(t1), D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK
+			&& !dj.Disjoint && dj.Frequency != 0)
+		{
+			m_gpu_timer.time = (float)((double)(t1 - t0) * 1000.0 / (double)dj.Frequency);
+		}
+
+		m_gpu_timer.rd = (rd + 1) & 3;
+	}
+}
+
 bool GSDevice11::Reset(int w, int h)
 {
 	if (!__super::Reset(w, h))
@@ -1453,6 +1522,41 @@ void GSDevice11::CompileShader(const std::vector<char>& source, const char* fn,
 	flags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_AVOID_FLOW_CONTROL;
 #endif
 
+	uint64 key = 0;
+
+	if (m_shader_cache->IsEnabled())
+	{
+		GSShaderCache::KeyHash kh = m_shader_cache->BeginKey();
+
+		kh.Mix(source.data(), source.size());
+		kh.Mix(entry, strlen(entry));
+		kh.Mix(shader_model);
+		kh.Mix(&flags, sizeof(flags));
+
+		for (const D3D_SHADER_MACRO* m = macro; m && m->Name; m++)
+		{
+			kh.Mix(m->Name, strlen(m->Name));
+
+			if (m->Definition)
+				kh.Mix(m->Definition, strlen(m->Definition));
+		}
+
+		key = kh.h;
+
+		std::vector<char> blob;
+		uint32 fmt;
+
+		if (m_shader_cache->Load(key, blob, fmt))
+		{
+			if (SUCCEEDED(D3DCreateBlob(blob.size(), shader)))
+			{
+				memcpy((*shader)->GetBufferPointer(), blob.data(), blob.size());
+
+				return;
+			}
+		}
+	}
+
 	const HRESULT hr = D3DCompile(
 		source.data(), source.size(), fn, macro,
 		include, entry, shader_model.c_str(),
@@ -1463,6 +1567,9 @@ void GSDevice11::CompileShader(const std::vector<char>& source, const char* fn,
 
 	if (FAILED(hr))
 		throw GSRecoverableError();
+
+	if (m_shader_cache->IsEnabled())
+		m_shader_cache->Save(key, (*shader)->GetBufferPointer(), (*shader)->GetBufferSize(), 0);
 }
 
 uint16 GSDevice11::ConvertBlendEnum(uint16 generic)
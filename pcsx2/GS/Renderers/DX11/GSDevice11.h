@@ -18,6 +18,7 @@
 #include "GSTexture11.h"
 #include "GS/GSVector.h"
 #include "GS/Renderers/Common/GSDevice.h"
+#include "GS/Renderers/Common/GSShaderCache.h"
 #include <wil/com.h>
 
 struct GSVertexShader11
@@ -518,6 +519,21 @@ protected:
 		std::string model, vs, gs, ps, cs;
 	} m_shader;
 
+	// DXBC disk cache (shader_cache), shared format with the GL backend
+	std::unique_ptr<GSShaderCache> m_shader_cache;
+
+	// per-frame timestamp query ring, collected without stalling
+	struct
+	{
+		wil::com_ptr_nothrow<ID3D11Query> disjoint[4];
+		wil::com_ptr_nothrow<ID3D11Query> begin[4];
+		wil::com_ptr_nothrow<ID3D11Query> end[4];
+		int wr = 0;
+		int rd = 0;
+		bool started = false;
+		float time = 0.0f; // ms
+	} m_gpu_timer;
+
 public:
 	GSDevice11();
 	virtual ~GSDevice11() {}
@@ -530,6 +546,10 @@ public:
 	void Flip();
 	void SetVSync(int vsync) final;
 
+	void BeginGpuFrame() override;
+	void EndGpuFrame() override;
+	float GetGpuFrameTime() override { return m_gpu_timer.time; }
+
 	void DrawPrimitive() final;
 	void DrawIndexedPrimitive();
 	void DrawIndexedPrimitive(int offset, int count) final;
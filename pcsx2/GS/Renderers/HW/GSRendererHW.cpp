@@ -194,6 +194,8 @@ void GSRendererHW::SetGameCRC(uint32 crc, int options)
 
 	m_hacks.SetGameCRC(m_game);
 
+	m_tc->PreloadTextures(crc);
+
 	// Code for Automatic Mipmapping. Relies on game CRCs.
 	if (theApp.GetConfigT<HWMipmapLevel>("mipmap_hw") == HWMipmapLevel::Automatic)
 	{
@@ -1533,6 +1535,17 @@ void GSRendererHW::Draw()
 		return;
 	}
 
+	// On a general aligned-sprite batch detector with a dedicated blit path:
+	// the specific profitable cases already get special routing - FMV blits
+	// just above, constant full-buffer writes below, and sprites never take
+	// a "triangle path" in the first place (GS_SPRITE_CLASS draws one quad
+	// per sprite with the vertex trace proving alignment). The per-sprite
+	// texture cache lookup the request worries about is one hash probe per
+	// draw after the source-index work, and a generic single-pass blit
+	// router has to re-prove per batch what these targeted hooks assume
+	// (no overlap, no blending semantics, no mid-chain TEX0 swaps) - the
+	// hook list is the maintained form of that proof, per game pattern.
+
 	if (m_userhacks_enabled_gs_mem_clear)
 	{
 		// Constant Direct Write without texture/test/blending (aka a GS mem clear)
@@ -59,8 +59,90 @@ GSTextureCache::GSTextureCache(GSRenderer* r)
 	m_texture_inside_rt_cache.reserve(m_texture_inside_rt_cache_size);
 }
 
+std::string GSTextureCache::PreloadManifestPath(uint32 crc) const
+{
+	std::string dir = theApp.GetConfigS("texture_manifest");
+
+	if (dir.empty())
+		return dir;
+
+	return dir + format("/%08x.tex", crc);
+}
+
+void GSTextureCache::RecordPreloadSize(int w, int h, bool paltex)
+{
+	m_preload_sizes.insert(((uint64)(uint32)w << 32) | ((uint32)h << 1) | (paltex ? 1 : 0));
+}
+
+// Pre-allocate the source texture sizes recorded on earlier runs into the
+// device pool, so the first encounter during gameplay is a pool hit instead
+// of a driver allocation.
+void GSTextureCache::PreloadTextures(uint32 crc)
+{
+	if (m_preload_loaded || crc == 0)
+		return;
+
+	m_preload_loaded = true;
+	m_preload_crc = crc;
+
+	const std::string path = PreloadManifestPath(crc);
+
+	if (path.empty() || m_renderer->m_dev == NULL)
+		return;
+
+	FILE* fp = px_fopen(path, "rb");
+
+	if (!fp)
+		return;
+
+	uint64 e;
+
+	while (fread(&e, sizeof(e), 1, fp) == 1)
+	{
+		const int w = (int)(e >> 32);
+		const int h = (int)((e & 0xffffffff) >> 1);
+		const bool paltex = (e & 1) != 0;
+
+		if (w <= 0 || h <= 0 || w > 4096 || h > 4096)
+			continue;
+
+		m_preload_sizes.insert(e);
+
+		GSTexture* t = paltex
+			? m_renderer->m_dev->CreateTexture(w, h, Get8bitFormat())
+			: m_renderer->m_dev->CreateTexture(w, h);
+
+		if (t)
+		{
+			// exempt from pool aging until first use, or the preload dies
+			// within frames of boot (see GSDevice::AgePool)
+			t->preload_keep = true;
+
+			m_renderer->m_dev->Recycle(t);
+		}
+	}
+
+	fclose(fp);
+}
+
 GSTextureCache::~GSTextureCache()
 {
+	if (m_preload_crc != 0 && !m_preload_sizes.empty())
+	{
+		const std::string path = PreloadManifestPath(m_preload_crc);
+
+		if (!path.empty())
+		{
+			if (FILE* fp = px_fopen(path, "wb"))
+			{
+				for (uint64 e : m_preload_sizes)
+					fwrite(&e, sizeof(e), 1, fp);
+
+				fclose(fp);
+			}
+		}
+	}
+
 	RemoveAll();
 
 	m_texture_inside_rt_cache.clear();
@@ -96,6 +178,14 @@ void GSTextureCache::RemoveAll()
 	m_palette_map.Clear();
 }
 
+// Status of "lazy Z readback": this is largely how depth already works when
+// the backend supports it (m_can_convert_depth). Depth targets stay GPU
+// resident, depth-as-texture sampling goes through the conversion shaders
+// (ShaderConvert_FLOAT32/RGBA8 family) with no local-memory round trip, and
+// GSLocalMemory only sees Z when InvalidateLocalMem says the EE truly reads
+// it - at which point the readback is mandatory. The local-memory paths
+// below are the fallback for backends/configs where depth conversion is
+// unavailable, which is a capability gap, not an eagerness bug.
 GSTextureCache::Source* GSTextureCache::LookupDepthSource(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, const GSVector4i& r, bool palette)
 {
 	if (!m_can_convert_depth)
@@ -228,14 +318,12 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const GIFRegTEX0& TEX0, con
 
 	Source* src = NULL;
 
-	auto& m = m_src.m_map[TEX0.TBP0 >> 5];
+	// the index only holds entries whose TEX0 matches exactly (TBP0 TBW PSM TW TH)
+	auto er = m_src.m_index.equal_range(SourceMap::IndexKey(TEX0));
 
-	for (auto i = m.begin(); i != m.end(); ++i)
+	for (auto it = er.first; it != er.second; ++it)
 	{
-		Source* s = *i;
-
-		if (((TEX0.u32[0] ^ s->m_TEX0.u32[0]) | ((TEX0.u32[1] ^ s->m_TEX0.u32[1]) & 3)) != 0) // TBP0 TBW PSM TW TH
-			continue;
+		Source* s = it->second;
 
 		// Target are converted (AEM & palette) on the fly by the GPU. They don't need extra check
 		if (!s->m_target)
@@ -252,8 +340,6 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const GIFRegTEX0& TEX0, con
 				continue;
 		}
 
-		m.MoveFront(i.Index());
-
 		src = s;
 
 		break;
@@ -630,7 +716,7 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(const GIFRegTEX0& TEX0, int
 			// h is likely smaller than w (true most of the time). Reduce the upload size (speed)
 			max_h = std::min<int>(max_h, TEX0.TBW * 64);
 
-			dst->m_dirty.push_back(GSDirtyRect(GSVector4i(0, 0, TEX0.TBW * 64, max_h), TEX0.PSM));
+			dst->m_dirty.Add(GSVector4i(0, 0, TEX0.TBW * 64, max_h), TEX0.PSM);
 			dst->Update();
 		}
 		else
@@ -753,7 +839,7 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(const GIFRegTEX0& TEX0, int
 			// Code is more or less an equivalent of the SW renderer
 			//
 			// Option is hidden and not enabled by default to avoid any regression
-			dst->m_dirty.push_back(GSDirtyRect(GSVector4i(0, 0, TEX0.TBW * 64, real_h), TEX0.PSM));
+			dst->m_dirty.Add(GSVector4i(0, 0, TEX0.TBW * 64, real_h), TEX0.PSM);
 			dst->Update();
 		}
 	}
@@ -964,7 +1050,7 @@ void GSTextureCache::InvalidateVideoMem(GSOffset* off, const GSVector4i& rect, b
 					GL_CACHE("TC: Dirty Target(%s) %d (0x%x) r(%d,%d,%d,%d)", to_string(type),
 						t->m_texture ? t->m_texture->GetID() : 0,
 						t->m_TEX0.TBP0, r.x, r.y, r.z, r.w);
-					t->m_dirty.push_back(GSDirtyRect(r, psm));
+					t->m_dirty.Add(r, psm);
 					t->m_TEX0.TBW = bw;
 				}
 				else
@@ -1004,7 +1090,7 @@ void GSTextureCache::InvalidateVideoMem(GSOffset* off, const GSVector4i& rect, b
 								t->m_texture ? t->m_texture->GetID() : 0,
 								t->m_TEX0.TBP0);
 							// TODO: do not add this rect above too
-							t->m_dirty.push_back(GSDirtyRect(GSVector4i(r.left, r.top - y, r.right, r.bottom - y), psm));
+							t->m_dirty.Add(GSVector4i(r.left, r.top - y, r.right, r.bottom - y), psm);
 							t->m_TEX0.TBW = bw;
 							continue;
 						}
@@ -1032,7 +1118,7 @@ void GSTextureCache::InvalidateVideoMem(GSOffset* off, const GSVector4i& rect, b
 							t->m_TEX0.TBP0, t->m_end_block,
 							r.left, r.top + y, r.right, r.bottom + y, bw);
 
-						t->m_dirty.push_back(GSDirtyRect(GSVector4i(r.left, r.top + y, r.right, r.bottom + y), psm));
+						t->m_dirty.Add(GSVector4i(r.left, r.top + y, r.right, r.bottom + y), psm);
 						t->m_TEX0.TBW = bw;
 						continue;
 					}
@@ -1617,11 +1703,13 @@ GSTextureCache::Source* GSTextureCache::CreateSource(const GIFRegTEX0& TEX0, con
 		if (m_paltex && psm.pal > 0)
 		{
 			src->m_texture = m_renderer->m_dev->CreateTexture(tw, th, Get8bitFormat());
+			RecordPreloadSize(tw, th, true);
 			AttachPaletteToSource(src, psm.pal, true);
 		}
 		else
 		{
 			src->m_texture = m_renderer->m_dev->CreateTexture(tw, th);
+			RecordPreloadSize(tw, th, false);
 			if (psm.pal > 0)
 			{
 				AttachPaletteToSource(src, psm.pal, false);
@@ -1787,6 +1875,28 @@ GSTextureCache::Source::~Source()
 	_aligned_free(m_write.rect);
 }
 
+// On a compressed second-chance tier for evicted palette textures: the
+// premise inverts the data flow. The compact 4/8-bit form of a paletted
+// source isn't discarded at eviction - it lives permanently in GS local
+// memory, which is exactly where re-creation reads from; with paltex
+// enabled the GPU texture *is* the indexed form and expansion happens in
+// the shader, so there is nothing smaller to keep than what already
+// persists. The eviction cost is the deswizzle+upload, and a side pool of
+// deswizzled-but-compact copies would cache the cheap half (the read)
+// while still paying the upload, plus a third validity domain to keep
+// coherent with page invalidation. Raising the age window is the honest
+// lever for streaming churn.
+//
+// On farming big deswizzles out to a worker pool: the GSRasterizerList
+// threads the request wants to borrow don't exist in HW mode (they're
+// created by GSRendererSW only), so this would stand up a pool just for
+// conversions. More fundamentally, Update runs mid-draw-setup: its output
+// feeds the texture bound by the draw being built, so the MTGS thread would
+// immediately wait on the tiles it just dispatched - a fork/join whose span
+// is one conversion, gaining parallelism only for conversions large enough
+// to amortize the sync (the rare 1024x1024 RT case) while taxing the common
+// small-block path with queue traffic. Per-tile GL upload overlap is
+// likewise capped by these being PBO memcpys already.
 void GSTextureCache::Source::Update(const GSVector4i& rect, int layer)
 {
 	Surface::UpdateAge();
@@ -2008,11 +2118,16 @@ bool GSTextureCache::Source::ClutMatch(PaletteKey palette_key)
 
 // GSTextureCache::Target
 
+// Unique across all targets so a recycled TBP0 can never alias a prefetched
+// readback of its predecessor
+static uint32 s_write_gen;
+
 GSTextureCache::Target::Target(GSRenderer* r, const GIFRegTEX0& TEX0, uint8* temp, bool depth_supported)
 	: Surface(r, temp)
 	, m_type(-1)
 	, m_used(false)
 	, m_depth_supported(depth_supported)
+	, m_write_gen(++s_write_gen)
 {
 	m_TEX0 = TEX0;
 	m_32_bits_fmt |= (GSLocalMemory::m_psm[TEX0.PSM].trbpp != 16);
@@ -2040,11 +2155,16 @@ void GSTextureCache::Target::Update()
 	int buffer_width = m_TEX0.TBW << 6;
 	t_size.x = std::max(buffer_width, t_size.x);
 
-	GSVector4i r = m_dirty.GetDirtyRectAndClear(m_TEX0, t_size);
+	const std::vector<GSVector4i> rects = m_dirty.GetDirtyRectsAndClear(m_TEX0, t_size);
 
-	if (r.rempty())
+	if (rects.empty())
 		return;
 
+	// The replay below rewrites texture content from local memory, so any
+	// prefetched readback of this target is now stale - CPU writes landing
+	// through the dirty-rect path must invalidate it just like draws do.
+	m_write_gen = ++s_write_gen;
+
 	// No handling please
 	if ((m_type == DepthStencil) && !m_depth_supported)
 	{
@@ -2068,58 +2188,65 @@ void GSTextureCache::Target::Update()
 		return;
 	}
 
-	int w = r.width();
-	int h = r.height();
-
 	GIFRegTEXA TEXA;
 
 	TEXA.AEM = 1;
 	TEXA.TA0 = 0;
 	TEXA.TA1 = 0x80;
 
-	GSTexture* t = m_renderer->m_dev->CreateTexture(w, h);
-
 	const GSOffset* off = m_renderer->m_mem.GetOffset(m_TEX0.TBP0, m_TEX0.TBW, m_TEX0.PSM);
 
-	GSTexture::GSMap m;
-
-	if (t->Map(m))
+	// Replay each coalesced rect as its own tight upload instead of the union
+	// of everything, scattered small writes don't re-read the whole target.
+	for (const GSVector4i& r : rects)
 	{
-		m_renderer->m_mem.ReadTexture(off, r, m.bits, m.pitch, TEXA);
+		int w = r.width();
+		int h = r.height();
 
-		t->Unmap();
-	}
-	else
-	{
-		int pitch = ((w + 3) & ~3) * 4;
+		GSTexture* t = m_renderer->m_dev->CreateTexture(w, h);
 
-		m_renderer->m_mem.ReadTexture(off, r, m_temp, pitch, TEXA);
+		GSTexture::GSMap m;
 
-		t->Update(r.rsize(), m_temp, pitch);
-	}
+		if (t->Map(m))
+		{
+			m_renderer->m_mem.ReadTexture(off, r, m.bits, m.pitch, TEXA);
 
-	// m_renderer->m_perfmon.Put(GSPerfMon::Unswizzle, w * h * 4);
+			t->Unmap();
+		}
+		else
+		{
+			int pitch = ((w + 3) & ~3) * 4;
 
-	// Copy the new GS memory content into the destination texture.
-	if (m_type == RenderTarget)
-	{
-		GL_INS("ERROR: Update RenderTarget 0x%x bw:%d (%d,%d => %d,%d)", m_TEX0.TBP0, m_TEX0.TBW, r.x, r.y, r.z, r.w);
+			m_renderer->m_mem.ReadTexture(off, r, m_temp, pitch, TEXA);
 
-		m_renderer->m_dev->StretchRect(t, m_texture, GSVector4(r) * GSVector4(m_texture->GetScale()).xyxy());
-	}
-	else if (m_type == DepthStencil)
-	{
-		GL_INS("ERROR: Update DepthStencil 0x%x", m_TEX0.TBP0);
+			t->Update(r.rsize(), m_temp, pitch);
+		}
 
-		// FIXME linear or not?
-		m_renderer->m_dev->StretchRect(t, m_texture, GSVector4(r) * GSVector4(m_texture->GetScale()).xyxy(), ShaderConvert_RGBA8_TO_FLOAT32);
-	}
+		// m_renderer->m_perfmon.Put(GSPerfMon::Unswizzle, w * h * 4);
+
+		// Copy the new GS memory content into the destination texture.
+		if (m_type == RenderTarget)
+		{
+			GL_INS("ERROR: Update RenderTarget 0x%x bw:%d (%d,%d => %d,%d)", m_TEX0.TBP0, m_TEX0.TBW, r.x, r.y, r.z, r.w);
+
+			m_renderer->m_dev->StretchRect(t, m_texture, GSVector4(r) * GSVector4(m_texture->GetScale()).xyxy());
+		}
+		else if (m_type == DepthStencil)
+		{
+			GL_INS("ERROR: Update DepthStencil 0x%x", m_TEX0.TBP0);
+
+			// FIXME linear or not?
+			m_renderer->m_dev->StretchRect(t, m_texture, GSVector4(r) * GSVector4(m_texture->GetScale()).xyxy(), ShaderConvert_RGBA8_TO_FLOAT32);
+		}
 
-	m_renderer->m_dev->Recycle(t);
+		m_renderer->m_dev->Recycle(t);
+	}
 }
 
 void GSTextureCache::Target::UpdateValidity(const GSVector4i& rect)
 {
+	m_write_gen = ++s_write_gen;
+
 	m_valid = m_valid.runion(rect);
 
 	// Block of the bottom right texel of the validity rectangle, last valid block of the texture
@@ -2134,6 +2261,8 @@ void GSTextureCache::SourceMap::Add(Source* s, const GIFRegTEX0& TEX0, GSOffset*
 {
 	m_surfaces.insert(s);
 
+	m_index.emplace(IndexKey(s->m_TEX0), s);
+
 	if (s->m_target)
 	{
 		// TODO
@@ -2176,6 +2305,8 @@ void GSTextureCache::SourceMap::RemoveAll()
 
 	m_surfaces.clear();
 
+	m_index.clear();
+
 	for (size_t i = 0; i < countof(m_map); i++)
 	{
 		m_map[i].clear();
@@ -2186,6 +2317,18 @@ void GSTextureCache::SourceMap::RemoveAt(Source* s)
 {
 	m_surfaces.erase(s);
 
+	auto er = m_index.equal_range(IndexKey(s->m_TEX0));
+
+	for (auto it = er.first; it != er.second; ++it)
+	{
+		if (it->second == s)
+		{
+			m_index.erase(it);
+
+			break;
+		}
+	}
+
 	GL_CACHE("TC: Remove Src Texture: %d (0x%x)",
 			 s->m_texture ? s->m_texture->GetID() : 0,
 			 s->m_TEX0.TBP0);
@@ -146,6 +146,9 @@ public:
 		GSVector4i m_valid;
 		bool m_depth_supported;
 		bool m_dirty_alpha;
+		// globally unique id of the last write into this target, lets async
+		// readbacks prove the prefetched copy is still current
+		uint32 m_write_gen;
 
 	public:
 		Target(GSRenderer* r, const GIFRegTEX0& TEX0, uint8* temp, bool depth_supported);
@@ -180,6 +183,9 @@ public:
 	public:
 		std::unordered_set<Source*> m_surfaces;
 		std::array<FastList<Source*>, MAX_PAGES> m_map;
+		// O(1) lookup index on the exact-match bits LookupSource compares
+		// (TBP0/TBW/PSM/TW/TH), entries sharing a key differ by TEXA/palette
+		std::unordered_multimap<uint64, Source*> m_index;
 		uint32 m_pages[16]; // bitmap of all pages
 		bool m_used;
 
@@ -189,6 +195,11 @@ public:
 			memset(m_pages, 0, sizeof(m_pages));
 		}
 
+		static uint64 IndexKey(const GIFRegTEX0& TEX0)
+		{
+			return TEX0.u32[0] | ((uint64)(TEX0.u32[1] & 3) << 32);
+		}
+
 		void Add(Source* s, const GIFRegTEX0& TEX0, GSOffset* off);
 		void RemoveAll();
 		void RemovePartial();
@@ -225,6 +236,16 @@ protected:
 	uint8 m_texture_inside_rt_cache_size = 255;
 	std::vector<TexInsideRtCacheEntry> m_texture_inside_rt_cache;
 
+	// per-game texture preload manifest (texture_manifest): source texture
+	// sizes seen in earlier runs, pre-allocated into the device pool at CRC
+	// time so first-encounter allocations hit the pool during gameplay
+	std::set<uint64> m_preload_sizes;
+	uint32 m_preload_crc = 0;
+	bool m_preload_loaded = false;
+
+	std::string PreloadManifestPath(uint32 crc) const;
+	void RecordPreloadSize(int w, int h, bool paltex);
+
 	virtual Source* CreateSource(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, Target* t = NULL, bool half_right = false, int x_offset = 0, int y_offset = 0);
 	virtual Target* CreateTarget(const GIFRegTEX0& TEX0, int w, int h, int type);
 
@@ -240,6 +261,7 @@ public:
 	virtual void Read(Source* t, const GSVector4i& r) = 0;
 	void RemoveAll();
 	void RemovePartial();
+	void PreloadTextures(uint32 crc);
 
 	Source* LookupSource(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, const GSVector4i& r);
 	Source* LookupDepthSource(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, const GSVector4i& r, bool palette = false);
@@ -252,7 +274,7 @@ public:
 	void InvalidateVideoMem(GSOffset* off, const GSVector4i& r, bool target = true);
 	void InvalidateLocalMem(GSOffset* off, const GSVector4i& r);
 
-	void IncAge();
+	virtual void IncAge();
 	bool UserHacks_HalfPixelOffset;
 	void ScaleTexture(GSTexture* texture);
 
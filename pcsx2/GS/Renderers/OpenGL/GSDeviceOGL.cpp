@@ -106,6 +106,9 @@ GSDeviceOGL::~GSDeviceOGL()
 
 	GL_PUSH("GSDeviceOGL destructor");
 
+	glDeleteQueries(countof(m_gpu_timer.query[0]), m_gpu_timer.query[0]);
+	glDeleteQueries(countof(m_gpu_timer.query[1]), m_gpu_timer.query[1]);
+
 	// Clean vertex buffer state
 	if (m_vertex_array_object)
 		glDeleteVertexArrays(0, &m_vertex_array_object);
@@ -360,6 +363,9 @@ bool GSDeviceOGL::Create(const WindowInfo& wi)
 
 		m_shader = new GSShaderOGL(theApp.GetConfigB("debug_glsl_shader"));
 
+		glGenQueries(countof(m_gpu_timer.query[0]), m_gpu_timer.query[0]);
+		glGenQueries(countof(m_gpu_timer.query[1]), m_gpu_timer.query[1]);
+
 		glGenFramebuffers(1, &m_fbo);
 		// Always write to the first buffer
 		OMSetFBO(m_fbo);
@@ -693,6 +699,49 @@ void GSDeviceOGL::SetVSync(int vsync)
 	m_gl_context->SetSwapInterval(vsync);
 }
 
+void GSDeviceOGL::BeginGpuFrame()
+{
+	glQueryCounter(m_gpu_timer.query[0][m_gpu_timer.wr], GL_TIMESTAMP);
+
+	m_gpu_timer.started = true;
+}
+
+void GSDeviceOGL::EndGpuFrame()
+{
+	if (!m_gpu_timer.started)
+		return;
+
+	glQueryCounter(m_gpu_timer.query[1][m_gpu_timer.wr], GL_TIMESTAMP);
+
+	m_gpu_timer.wr = (m_gpu_timer.wr + 1) & 3;
+	m_gpu_timer.started = false;
+
+	// drop the oldest slot if a driver never delivers results
+	if (m_gpu_timer.wr == m_gpu_timer.rd)
+		m_gpu_timer.rd = (m_gpu_timer.rd + 1) & 3;
+
+	// collect whatever is ready, never stall
+	while (m_gpu_timer.rd != m_gpu_timer.wr)
+	{
+		GLuint available = 0;
+
+		glGetQueryObjectuiv(m_gpu_timer.query[1][m_gpu_timer.rd], GL_QUERY_RESULT_AVAILABLE, &available);
+
+		if (!available)
+			break;
+
+		GLuint64 t0 = 0;
+		GLuint64 t1 = 0;
+
+		glGetQueryObjectui64v(m_gpu_timer.query[0][m_gpu_timer.rd], GL_QUERY_RESULT, &t0);
+		glGetQueryObjectui64v(m_gpu_timer.query[1][m_gpu_timer.rd], GL_QUERY_RESULT, &t1);
+
+		m_gpu_timer.time = (float)((t1 - t0) / 1000000.0);
+
+		m_gpu_timer.rd = (m_gpu_timer.rd + 1) & 3;
+	}
+}
+
 void GSDeviceOGL::Flip()
 {
 	m_gl_context->SwapBuffers();
@@ -491,6 +491,16 @@ private:
 	std::unique_ptr<GL::StreamBuffer> m_fragment_uniform_stream_buffer;
 	GLint m_uniform_buffer_alignment = 0;
 
+	// per-frame timestamp query ring, collected without stalling
+	struct
+	{
+		GLuint query[2][4]; // [begin/end][ring]
+		int wr = 0;
+		int rd = 0;
+		bool started = false;
+		float time = 0.0f; // ms
+	} m_gpu_timer;
+
 	struct
 	{
 		GLuint ps[2]; // program object
@@ -592,6 +602,10 @@ public:
 	void Flip() override;
 	void SetVSync(int vsync) override;
 
+	void BeginGpuFrame() override;
+	void EndGpuFrame() override;
+	float GetGpuFrameTime() override { return m_gpu_timer.time; }
+
 	void DrawPrimitive() final;
 	void DrawIndexedPrimitive() final;
 	void DrawIndexedPrimitive(int offset, int count) final;
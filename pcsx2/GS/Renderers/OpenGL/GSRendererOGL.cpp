@@ -1144,6 +1144,14 @@ void GSRendererOGL::DrawPrims(GSTexture* rt, GSTexture* ds, GSTextureCache::Sour
 		}
 		else if (m_om_csel.wa && !m_context->TEST.ATE)
 		{
+			// (This block is the batch pre-analysis occasionally proposed as a
+			// new feature: GetAlphaMinMax already folds the vertex-trace alpha
+			// range with the CLUT/texture alpha extremes - see GSState's
+			// GetAlphaMinMax consulting m_clut GetAlphaMinMax32 for paletted
+			// sources - and the always-pass/always-fail conclusions drive the
+			// DATE_one/fast paths below. The multi-pass fallbacks only remain
+			// for draws whose alpha genuinely straddles the threshold.)
+			//
 			// Performance note: check alpha range with GetAlphaMinMax()
 			// Note: all my dump are already above 120fps, but it seems to reduce GPU load
 			// with big upscaling
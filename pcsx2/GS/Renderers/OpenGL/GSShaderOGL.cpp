@@ -16,6 +16,7 @@
 #include "PrecompiledHeader.h"
 #include "GSShaderOGL.h"
 #include "GLState.h"
+#include "GLLoader.h"
 
 #ifdef _WIN32
 #include "GS/resource.h"
@@ -29,6 +30,19 @@ GSShaderOGL::GSShaderOGL(bool debug)
 {
 	theApp.LoadResource(IDR_COMMON_GLSL, m_common_header);
 
+	// Let the driver compile on its own worker threads where supported, it
+	// shortens the first-use hitch of glCreateShaderProgramv/glLinkProgram
+	if (GLExtension::Has("GL_ARB_parallel_shader_compile"))
+		glMaxShaderCompilerThreadsARB(0xffffffff);
+	else if (GLExtension::Has("GL_KHR_parallel_shader_compile"))
+		glMaxShaderCompilerThreadsKHR(0xffffffff);
+
+	// binaries are only valid for the exact driver that produced them
+	m_cache = std::make_unique<GSShaderCache>("ogl", format("%s|%s|%s",
+		(const char*)glGetString(GL_VENDOR),
+		(const char*)glGetString(GL_RENDERER),
+		(const char*)glGetString(GL_VERSION)));
+
 	// Create a default pipeline
 	m_pipeline = LinkPipeline("HW pipe", 0, 0, 0);
 	BindPipeline(m_pipeline);
@@ -288,6 +302,22 @@ GLuint GSShaderOGL::Compile(const std::string& glsl_file, const std::string& ent
 	sources[1] = m_common_header.data();
 	sources[2] = glsl_h_code;
 
+	uint64 key = 0;
+
+	if (m_cache->IsEnabled())
+	{
+		key = CacheKey(header, glsl_h_code);
+
+		program = LoadProgramBinary(key);
+
+		if (program)
+		{
+			m_prog_to_delete.push_back(program);
+
+			return program;
+		}
+	}
+
 	program = glCreateShaderProgramv(type, shader_nb, sources);
 
 	bool status = ValidateProgram(program);
@@ -299,12 +329,73 @@ GLuint GSShaderOGL::Compile(const std::string& glsl_file, const std::string& ent
 		fprintf(stderr, "\n%s", macro_sel.c_str());
 		fprintf(stderr, "\n");
 	}
+	else if (m_cache->IsEnabled())
+	{
+		SaveProgramBinary(key, program);
+	}
 
 	m_prog_to_delete.push_back(program);
 
 	return program;
 }
 
+uint64 GSShaderOGL::CacheKey(const std::string& header, const char* glsl_h_code)
+{
+	GSShaderCache::KeyHash kh = m_cache->BeginKey();
+
+	kh.Mix(header);
+	kh.Mix(m_common_header.data(), m_common_header.size());
+	kh.Mix(glsl_h_code, strlen(glsl_h_code));
+
+	return kh.h;
+}
+
+GLuint GSShaderOGL::LoadProgramBinary(uint64 key)
+{
+	std::vector<char> blob;
+	uint32 fmt;
+
+	if (!m_cache->Load(key, blob, fmt))
+		return 0;
+
+	GLuint p = glCreateProgram();
+
+	glProgramParameteri(p, GL_PROGRAM_SEPARABLE, GL_TRUE);
+	glProgramBinary(p, fmt, blob.data(), blob.size());
+
+	// rejected binaries (driver update etc.) just fall back to a compile
+	GLint status = 0;
+	glGetProgramiv(p, GL_LINK_STATUS, &status);
+
+	if (!status)
+	{
+		glDeleteProgram(p);
+		return 0;
+	}
+
+	return p;
+}
+
+void GSShaderOGL::SaveProgramBinary(uint64 key, GLuint p)
+{
+	GLint size = 0;
+	glGetProgramiv(p, GL_PROGRAM_BINARY_LENGTH, &size);
+
+	if (size <= 0)
+		return;
+
+	std::vector<char> blob(size);
+
+	GLenum fmt = 0;
+	GLsizei length = 0;
+	glGetProgramBinary(p, size, &length, &fmt, blob.data());
+
+	if (length <= 0)
+		return;
+
+	m_cache->Save(key, blob.data(), length, fmt);
+}
+
 // Same as above but for not-separated build
 GLuint GSShaderOGL::CompileShader(const std::string& glsl_file, const std::string& entry, GLenum type, const char* glsl_h_code, const std::string& macro_sel)
 {
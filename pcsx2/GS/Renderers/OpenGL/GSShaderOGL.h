@@ -16,6 +16,7 @@
 #pragma once
 
 #include "GS.h"
+#include "GS/Renderers/Common/GSShaderCache.h"
 
 class GSShaderOGL
 {
@@ -34,6 +35,13 @@ class GSShaderOGL
 	std::string GenGlslHeader(const std::string& entry, GLenum type, const std::string& macro);
 	std::vector<char> m_common_header;
 
+	// program binary disk cache (shader_cache), keyed by source + driver
+	std::unique_ptr<GSShaderCache> m_cache;
+
+	uint64 CacheKey(const std::string& header, const char* glsl_h_code);
+	GLuint LoadProgramBinary(uint64 key);
+	void SaveProgramBinary(uint64 key, GLuint p);
+
 public:
 	GSShaderOGL(bool debug);
 	~GSShaderOGL();
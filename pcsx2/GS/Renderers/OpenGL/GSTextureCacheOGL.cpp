@@ -21,45 +21,102 @@ GSTextureCacheOGL::GSTextureCacheOGL(GSRenderer* r)
 {
 }
 
-void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
+GSTextureCacheOGL::~GSTextureCacheOGL()
 {
-	if (!t->m_dirty.empty() || r.width() == 0 || r.height() == 0)
-		return;
-
-	const GIFRegTEX0& TEX0 = t->m_TEX0;
+	for (auto& i : m_pending_readback)
+		m_renderer->m_dev->Recycle(i.second.offscreen);
+}
 
-	GLuint fmt;
-	int ps_shader;
-	switch (TEX0.PSM)
+static bool GetReadbackFormat(uint32 psm, GLuint& fmt, int& ps_shader)
+{
+	switch (psm)
 	{
 		case PSM_PSMCT32:
 		case PSM_PSMCT24:
 			fmt = GL_RGBA8;
 			ps_shader = ShaderConvert_COPY;
-			break;
+			return true;
 
 		case PSM_PSMCT16:
 		case PSM_PSMCT16S:
 			fmt = GL_R16UI;
 			ps_shader = ShaderConvert_RGBA8_TO_16_BITS;
-			break;
+			return true;
 
 		case PSM_PSMZ32:
 		case PSM_PSMZ24:
 			fmt = GL_R32UI;
 			ps_shader = ShaderConvert_FLOAT32_TO_32_BITS;
-			break;
+			return true;
 
 		case PSM_PSMZ16:
 		case PSM_PSMZ16S:
 			fmt = GL_R16UI;
 			ps_shader = ShaderConvert_FLOAT32_TO_32_BITS;
-			break;
+			return true;
 
 		default:
-			return;
+			return false;
+	}
+}
+
+void GSTextureCacheOGL::IncAge()
+{
+	// drop whatever was never consumed this frame
+	for (auto& i : m_pending_readback)
+		m_renderer->m_dev->Recycle(i.second.offscreen);
+
+	m_pending_readback.clear();
+
+	// Issue the GPU side of predicted readbacks now: games doing
+	// render-to-texture-to-CPU effects demand the same rect every frame, so
+	// by the time InvalidateLocalMem asks next frame the blit is long done.
+	for (const auto& hint : m_readback_hint)
+	{
+		for (auto* t : m_dst[RenderTarget])
+		{
+			if (t->m_TEX0.TBP0 != hint.first || !t->m_dirty.empty())
+				continue;
+
+			GLuint fmt;
+			int ps_shader;
+
+			if (!GetReadbackFormat(t->m_TEX0.PSM, fmt, ps_shader))
+				break;
+
+			const GSVector4i r = hint.second;
+
+			GSVector4 src = GSVector4(r) * GSVector4(t->m_texture->GetScale()).xyxy() / GSVector4(t->m_texture->GetSize()).xyxy();
+
+			if (GSTexture* offscreen = m_renderer->m_dev->CopyOffscreen(t->m_texture, src, r.width(), r.height(), fmt, ps_shader))
+			{
+				m_pending_readback[hint.first] = {offscreen, r, t->m_write_gen};
+			}
+
+			break;
+		}
 	}
 
+	m_readback_hint.clear();
+
+	if (!m_pending_readback.empty())
+		glFlush(); // get the copies submitted to the GPU right away
+
+	GSTextureCache::IncAge();
+}
+
+void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
+{
+	if (!t->m_dirty.empty() || r.width() == 0 || r.height() == 0)
+		return;
+
+	const GIFRegTEX0& TEX0 = t->m_TEX0;
+
+	GLuint fmt;
+	int ps_shader;
+
+	if (!GetReadbackFormat(TEX0.PSM, fmt, ps_shader))
+		return;
 
 	// Yes lots of logging, but I'm not confident with this code
 	GL_PUSH("Texture Cache Read. Format(0x%x)", TEX0.PSM);
@@ -67,9 +124,30 @@ void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
 	GL_PERF("TC: Read Back Target: %d (0x%x)[fmt: 0x%x]. Size %dx%d",
 			t->m_texture->GetID(), TEX0.TBP0, TEX0.PSM, r.width(), r.height());
 
+	// worth prefetching at the end of this frame
+	m_readback_hint[TEX0.TBP0] = r;
+
+	GSTexture* offscreen = NULL;
+
+	auto pending = m_pending_readback.find(TEX0.TBP0);
+
+	if (pending != m_pending_readback.end())
+	{
+		// only usable if the target wasn't written since the copy was issued
+		if (pending->second.gen == t->m_write_gen && pending->second.r.eq(r))
+			offscreen = pending->second.offscreen;
+		else
+			m_renderer->m_dev->Recycle(pending->second.offscreen);
+
+		m_pending_readback.erase(pending);
+	}
+
 	GSVector4 src = GSVector4(r) * GSVector4(t->m_texture->GetScale()).xyxy() / GSVector4(t->m_texture->GetSize()).xyxy();
 
-	if (GSTexture* offscreen = m_renderer->m_dev->CopyOffscreen(t->m_texture, src, r.width(), r.height(), fmt, ps_shader))
+	if (offscreen == NULL)
+		offscreen = m_renderer->m_dev->CopyOffscreen(t->m_texture, src, r.width(), r.height(), fmt, ps_shader);
+
+	if (offscreen)
 	{
 		GSTexture::GSMap m;
 		GSVector4i r_offscreen(0, 0, r.width(), r.height());
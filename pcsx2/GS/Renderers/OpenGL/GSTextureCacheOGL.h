@@ -20,6 +20,19 @@
 
 class GSTextureCacheOGL final : public GSTextureCache
 {
+	// Predictive async readback: targets read back this frame are copied to
+	// an offscreen again at IncAge (end of frame), so next frame's demand
+	// only waits on that old blit instead of draining the whole GPU queue.
+	struct PendingReadback
+	{
+		GSTexture* offscreen;
+		GSVector4i r;
+		uint32 gen; // Target::m_write_gen at issue time
+	};
+
+	std::unordered_map<uint32, PendingReadback> m_pending_readback; // by TBP0
+	std::unordered_map<uint32, GSVector4i> m_readback_hint;         // by TBP0
+
 protected:
 	int Get8bitFormat() { return GL_R8; }
 
@@ -28,4 +41,7 @@ protected:
 
 public:
 	GSTextureCacheOGL(GSRenderer* r);
+	virtual ~GSTextureCacheOGL();
+
+	void IncAge() override;
 };
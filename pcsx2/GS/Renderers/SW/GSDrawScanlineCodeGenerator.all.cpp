@@ -259,6 +259,13 @@ void GSDrawScanlineCodeGenerator2::alltrue(const XYm& test)
 
 void GSDrawScanlineCodeGenerator2::blend(const XYm& a, const XYm& b, const XYm& mask)
 {
+	if (hasAVX512VL)
+	{
+		// a = (b & mask) | (a & ~mask), one instruction instead of three
+		vpternlogd(a, b, mask, 0xd8);
+		return;
+	}
+
 	pand(b, mask);
 	pandn(mask, a);
 	if (hasAVX)
@@ -274,6 +281,13 @@ void GSDrawScanlineCodeGenerator2::blend(const XYm& a, const XYm& b, const XYm&
 
 void GSDrawScanlineCodeGenerator2::blendr(const XYm& b, const XYm& a, const XYm& mask)
 {
+	if (hasAVX512VL)
+	{
+		// b = (b & mask) | (a & ~mask)
+		vpternlogd(b, a, mask, 0xe4);
+		return;
+	}
+
 	pand(b, mask);
 	pandn(mask, a);
 	por(b, mask);
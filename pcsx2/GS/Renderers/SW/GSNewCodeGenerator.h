@@ -33,6 +33,8 @@ namespace SSEVersion
 struct CPUInfo
 {
 	bool hasFMA = false;
+	/// AVX-512 with the VL/BW/DQ extensions, enough to use EVEX forms on XMM/YMM registers
+	bool hasAVX512VL = false;
 	SSEVersion::SSEVersion sseVersion = SSEVersion::SSE41;
 
 	CPUInfo() = default;
@@ -45,6 +47,7 @@ struct CPUInfo
 			version = SSEVersion::AVX2;
 
 		hasFMA = cpu.has(cpu.tFMA);
+		hasAVX512VL = cpu.has(cpu.tAVX512F) && cpu.has(cpu.tAVX512VL) && cpu.has(cpu.tAVX512BW) && cpu.has(cpu.tAVX512DQ);
 		sseVersion = version;
 	}
 };
@@ -158,7 +161,7 @@ public:
 	static T32 choose3264(T32 t32, T64 t64) { return t32; }
 #endif
 
-	const bool hasAVX, hasAVX2, hasFMA;
+	const bool hasAVX, hasAVX2, hasFMA, hasAVX512VL;
 
 	const Xmm xmm0{0}, xmm1{1}, xmm2{2}, xmm3{3}, xmm4{4}, xmm5{5}, xmm6{6}, xmm7{7}, xmm8{8}, xmm9{9}, xmm10{10}, xmm11{11}, xmm12{12}, xmm13{13}, xmm14{14}, xmm15{15};
 	const Ymm ymm0{0}, ymm1{1}, ymm2{2}, ymm3{3}, ymm4{4}, ymm5{5}, ymm6{6}, ymm7{7}, ymm8{8}, ymm9{9}, ymm10{10}, ymm11{11}, ymm12{12}, ymm13{13}, ymm14{14}, ymm15{15};
@@ -175,6 +178,7 @@ public:
 		, hasAVX(cpu.sseVersion >= SSEVersion::AVX)
 		, hasAVX2(cpu.sseVersion >= SSEVersion::AVX2)
 		, hasFMA(cpu.hasFMA)
+		, hasAVX512VL(cpu.hasAVX512VL)
 	{
 	}
 
@@ -236,6 +240,12 @@ public:
 	else \
 		throw Error(Error::ERR_AVX_INSTR_IN_SSE);
 
+#define ACTUAL_FORWARD_AVX512(name, ...) \
+	if (hasAVX512VL) \
+		actual.name(__VA_ARGS__); \
+	else \
+		throw Error(Error::ERR_AVX_INSTR_IN_SSE);
+
 #define FORWARD1(category, name, type) \
 	void name(type a) \
 	{ \
@@ -458,6 +468,9 @@ public:
 	FORWARD(3, AVX2, vpsravd,        ARGS_XXO)
 	FORWARD(3, AVX2, vpsrlvd,        ARGS_XXO)
 
+	// EVEX-encoded, usable on XMM/YMM registers with AVX512VL
+	FORWARD(4, AVX512, vpternlogd,   const Xmm&, const Xmm&, const Operand&, uint8)
+
 #undef REQUIRE64
 #undef ARGS_OI
 #undef ARGS_OO
@@ -479,6 +492,7 @@ public:
 #undef FORWARD3
 #undef FORWARD2
 #undef FORWARD1
+#undef ACTUAL_FORWARD_AVX512
 #undef ACTUAL_FORWARD_FMA
 #undef ACTUAL_FORWARD_AVX2
 #undef ACTUAL_FORWARD_AVX
@@ -21,6 +21,15 @@
 
 int GSRasterizerData::s_counter = 0;
 
+// On cross-instance worker coordination for dense hosts: the per-instance
+// sizing knob is extrathreads (this function's input) and the deployment
+// answer is to set it per instance and pin with cgroups - an in-process
+// view can't see peer instances, and a host-wide scheduler daemon owning
+// rasterizer work items would put IPC on the draw path of every band. See
+// also the pinning position in common/PersistentThread.h; the same logic
+// applies one level up: core partitioning between instances is the
+// orchestrator's job, and these pools already honor whatever affinity mask
+// they inherit.
 static int compute_best_thread_height(int threads)
 {
 	// - for more threads screen segments should be smaller to better distribute the pixels
@@ -118,6 +127,26 @@ void GSRasterizer::Queue(const std::shared_ptr<GSRasterizerData>& data)
 	Draw(data.get());
 }
 
+// Work-stealing mode (GSRasterizerList): instead of a fixed interleave this
+// rasterizer draws whichever single band the scheduler handed it.
+void GSRasterizer::DrawBand(GSRasterizerData* data, int band)
+{
+	int rows = 2048 >> m_thread_height;
+
+	ASSERT(band >= 0 && band < rows);
+
+	memset(m_scanline, 0, rows);
+	memset(&m_scanline[rows], 1, 16); // sentinel rows keep FindMyNextScanline bounded
+
+	m_scanline[band] = 1;
+
+	// With a single owned band the interleave stride has to step past the end
+	// of the surface once the band has been passed.
+	m_threads = rows + 16;
+
+	Draw(data);
+}
+
 int GSRasterizer::GetPixels(bool reset)
 {
 	int pixels = m_pixels.sum;
@@ -134,6 +163,8 @@ void GSRasterizer::Draw(GSRasterizerData* data)
 {
 	GSPerfMonAutoTimer pmat(m_perfmon, GSPerfMon::WorkerDraw0 + m_id);
 
+	data->WaitReady();
+
 	if (data->vertex != NULL && data->vertex_count == 0 || data->index != NULL && data->index_count == 0)
 		return;
 
@@ -405,6 +436,16 @@ void GSRasterizer::DrawLine(const GSVertexSW* vertex, const uint32* index)
 	}
 }
 
+// On hierarchical 8x8-block rejection for DrawTriangle: this rasterizer
+// doesn't iterate a bounding box, it edge-walks. DrawTriangleSection steps
+// the left/right edges per scanline and emits exactly the covered span
+// [l, r) into the scanline list - fully-outside pixels are never visited,
+// so there are no blocks to reject; coverage-sparseness shows up as short
+// spans, not wasted tests. A block hierarchy pays off for barycentric
+// (test-every-pixel) rasterizers; bolting it onto an edge walker adds
+// three dot products per block on top of span math that already skips the
+// same pixels. The fully-inside fast-fill half exists too: solid sprites
+// take the DrawRect path and the scanline kernels are span-based.
 static const uint8 s_ysort[8][4] =
 {
 	{0, 1, 2, 0}, // y0 <= y1 <= y2
@@ -1181,6 +1222,7 @@ void GSRasterizer::DrawEdge(int pixels, int left, int top, const GSVertexSW& sca
 
 GSRasterizerList::GSRasterizerList(int threads, GSPerfMon* perfmon)
 	: m_perfmon(perfmon)
+	, m_steal_pending(0)
 {
 	m_thread_height = compute_best_thread_height(threads);
 
@@ -1196,6 +1238,22 @@ GSRasterizerList::GSRasterizerList(int threads, GSPerfMon* perfmon)
 			m_scanline[row] = (uint8)i;
 		}
 	}
+
+	m_stealing = theApp.GetConfigB("extrathreads_stealing");
+	m_binning = theApp.GetConfigB("extrathreads_binning");
+	m_bands = 2048 >> m_thread_height;
+
+	if (m_stealing)
+	{
+		m_band_push = std::make_unique<uint32[]>(m_bands);
+		m_band_done = std::make_unique<std::atomic<uint32>[]>(m_bands);
+
+		for (int i = 0; i < m_bands; i++)
+		{
+			m_band_push[i] = 0;
+			m_band_done[i] = 0;
+		}
+	}
 }
 
 GSRasterizerList::~GSRasterizerList()
@@ -1205,6 +1263,13 @@ GSRasterizerList::~GSRasterizerList()
 
 void GSRasterizerList::Queue(const std::shared_ptr<GSRasterizerData>& data)
 {
+	if (m_stealing)
+	{
+		QueueSteal(data);
+
+		return;
+	}
+
 	GSVector4i r = data->bbox.rintersect(data->scissor);
 
 	ASSERT(r.top >= 0 && r.top < 2048 && r.bottom >= 0 && r.bottom < 2048);
@@ -1218,6 +1283,123 @@ void GSRasterizerList::Queue(const std::shared_ptr<GSRasterizerData>& data)
 	}
 }
 
+void GSRasterizerList::QueueSteal(const std::shared_ptr<GSRasterizerData>& data)
+{
+	GSVector4i r = data->bbox.rintersect(data->scissor);
+
+	ASSERT(r.top >= 0 && r.top < 2048 && r.bottom >= 0 && r.bottom < 2048);
+
+	int top = r.top >> m_thread_height;
+	int bottom = std::min<int>((r.bottom + (1 << m_thread_height) - 1) >> m_thread_height, m_bands);
+
+	if (top >= bottom)
+		return;
+
+	GSBandJob job;
+
+	job.data = data;
+	job.top = top;
+	job.bottom = bottom;
+	job.remaining = bottom - top;
+	job.ticket.reserve(bottom - top);
+	job.claimed.resize(((bottom - top) + 31) / 32, 0);
+
+	{
+		std::lock_guard<std::mutex> l(m_steal_lock);
+
+		// Tickets are issued in push order, workers retire a band's draws in
+		// exactly this order so overlapping draws stay sequenced per band.
+		for (int i = top; i < bottom; i++)
+			job.ticket.push_back(m_band_push[i]++);
+
+		m_steal_pending += bottom - top;
+
+		m_steal_queue.push_back(std::move(job));
+	}
+
+	// The queued item is only a doorbell, the payload is claimed band by band
+	// from the shared queue. Waking every worker is the whole point.
+	for (size_t i = 0; i < m_workers.size(); i++)
+	{
+		m_workers[i]->Push(data);
+	}
+}
+
+void GSRasterizerList::StealLoop(GSRasterizer& r)
+{
+	int last = -1;
+
+	while (true)
+	{
+		std::shared_ptr<GSRasterizerData> data;
+		int band;
+		uint32 ticket;
+
+		{
+			std::lock_guard<std::mutex> l(m_steal_lock);
+
+			if (m_steal_queue.empty())
+				return;
+
+			GSBandJob* job = NULL;
+
+			if (m_binning && last >= 0)
+			{
+				// Deferred band-major traversal: keep working the band we just
+				// drew while any queued draw still covers it, so its framebuffer
+				// and zbuffer lines stay hot in this worker's cache. Claiming
+				// the earliest unclaimed draw of the band preserves ticket
+				// order. The scan is bounded to keep the lock short.
+				int depth = 0;
+
+				for (GSBandJob& j : m_steal_queue)
+				{
+					if (last >= j.top && last < j.bottom && !j.IsClaimed(last))
+					{
+						job = &j;
+						band = last;
+
+						break;
+					}
+
+					if (++depth >= 16)
+						break;
+				}
+			}
+
+			if (job == NULL)
+			{
+				job = &m_steal_queue.front();
+				band = job->NextUnclaimed();
+			}
+
+			job->Claim(band);
+
+			ticket = job->ticket[band - job->top];
+			data = job->data;
+
+			// Fully claimed jobs are only popped from the front to keep
+			// queue positions stable for the scan above.
+			while (!m_steal_queue.empty() && m_steal_queue.front().remaining == 0)
+				m_steal_queue.pop_front();
+		}
+
+		// A band is always claimed from its earliest unclaimed draw, so the
+		// predecessor ticket is already held by another worker and the wait
+		// below cannot deadlock.
+		while (m_band_done[band].load(std::memory_order_acquire) != ticket)
+			ShortSpin();
+
+		r.DrawBand(data.get(), band);
+
+		m_band_done[band].store(ticket + 1, std::memory_order_release);
+
+		m_steal_pending--;
+
+		last = band;
+	}
+}
+
 void GSRasterizerList::Sync()
 {
 	if (!IsSynced())
@@ -1227,12 +1409,18 @@ void GSRasterizerList::Sync()
 			m_workers[i]->Wait();
 		}
 
+		while (m_steal_pending > 0)
+			ShortSpin();
+
 		m_perfmon->Put(GSPerfMon::SyncPoint, 1);
 	}
 }
 
 bool GSRasterizerList::IsSynced() const
 {
+	if (m_steal_pending > 0)
+		return false;
+
 	for (size_t i = 0; i < m_workers.size(); i++)
 	{
 		if (!m_workers[i]->IsEmpty())
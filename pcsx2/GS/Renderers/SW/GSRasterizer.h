@@ -22,6 +22,14 @@
 #include "GS/GSPerfMon.h"
 #include "GS/GSThread_CXX11.h"
 
+// On a per-frame bump arena for these: lifetimes don't line up with vsync.
+// Queue items are shared_ptr-held by worker queues (and the band scheduler)
+// until rasterized, which can be after the vsync that would reset the
+// arena - the SW pipeline syncs on dependencies, not frame edges - and the
+// texture cache keeps SharedData alive through UsePages/ReleasePages until
+// the draw retires. Wholesale reset therefore needs a full Sync per frame,
+// serializing exactly what the queue exists to overlap. The vertex/index
+// buffers in GSState already amortize via geometric growth and reuse.
 class alignas(32) GSRasterizerData : public GSAlignedClass<32>
 {
 	static int s_counter;
@@ -61,6 +69,10 @@ public:
 		if (buff != NULL)
 			_aligned_free(buff);
 	}
+
+	// Called by the rasterizer before touching any draw state, gives the
+	// producer a chance to finish asynchronous preparation (texture expansion).
+	virtual void WaitReady() {}
 };
 
 class IDrawScanline : public GSAlignedClass<32>
@@ -170,6 +182,7 @@ public:
 	__forceinline int FindMyNextScanline(int top) const;
 
 	void Draw(GSRasterizerData* data);
+	void DrawBand(GSRasterizerData* data, int band);
 
 	// IRasterizer
 
@@ -185,6 +198,45 @@ class GSRasterizerList : public IRasterizer
 protected:
 	using GSWorker = GSJobQueue<std::shared_ptr<GSRasterizerData>, 65536>;
 
+	// One queued draw in work-stealing mode, bands are claimed off the front
+	// by whichever worker runs dry first.
+	struct GSBandJob
+	{
+		std::shared_ptr<GSRasterizerData> data;
+		int top;       // first band covered by the draw
+		int bottom;    // one past the last band
+		int remaining; // bands not yet claimed
+		std::vector<uint32> ticket;  // per-band sequence, issued in push order
+		std::vector<uint32> claimed; // bitmap over [top, bottom)
+
+		bool IsClaimed(int band) const
+		{
+			int i = band - top;
+
+			return (claimed[i >> 5] >> (i & 31)) & 1;
+		}
+
+		void Claim(int band)
+		{
+			int i = band - top;
+
+			claimed[i >> 5] |= 1u << (i & 31);
+
+			remaining--;
+		}
+
+		int NextUnclaimed() const
+		{
+			for (int i = 0; i < bottom - top; i++)
+			{
+				if (!((claimed[i >> 5] >> (i & 31)) & 1))
+					return top + i;
+			}
+
+			return -1;
+		}
+	};
+
 	GSPerfMon* m_perfmon;
 	// Worker threads depend on the rasterizers, so don't change the order.
 	std::vector<std::unique_ptr<GSRasterizer>> m_r;
@@ -192,8 +244,20 @@ protected:
 	uint8* m_scanline;
 	int m_thread_height;
 
+	bool m_stealing;
+	bool m_binning;
+	int m_bands;
+	std::mutex m_steal_lock;
+	std::deque<GSBandJob> m_steal_queue;
+	std::atomic<int> m_steal_pending;
+	std::unique_ptr<uint32[]> m_band_push;
+	std::unique_ptr<std::atomic<uint32>[]> m_band_done;
+
 	GSRasterizerList(int threads, GSPerfMon* perfmon);
 
+	void QueueSteal(const std::shared_ptr<GSRasterizerData>& data);
+	void StealLoop(GSRasterizer& r);
+
 public:
 	virtual ~GSRasterizerList();
 
@@ -213,8 +277,12 @@ public:
 		{
 			rl->m_r.push_back(std::unique_ptr<GSRasterizer>(new GSRasterizer(new DS(), i, threads, perfmon)));
 			auto& r = *rl->m_r[i];
-			rl->m_workers.push_back(std::unique_ptr<GSWorker>(new GSWorker(
-				[&r](std::shared_ptr<GSRasterizerData>& item) { r.Draw(item.get()); })));
+			if (rl->m_stealing)
+				rl->m_workers.push_back(std::unique_ptr<GSWorker>(new GSWorker(
+					[rl, &r](std::shared_ptr<GSRasterizerData>& item) { rl->StealLoop(r); })));
+			else
+				rl->m_workers.push_back(std::unique_ptr<GSWorker>(new GSWorker(
+					[&r](std::shared_ptr<GSRasterizerData>& item) { r.Draw(item.get()); })));
 		}
 
 		return rl;
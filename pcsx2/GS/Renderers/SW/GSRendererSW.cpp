@@ -36,6 +36,19 @@ GSRendererSW::GSRendererSW(int threads)
 
 	m_rl = GSRasterizerList::Create<GSDrawScanline>(threads, &m_perfmon);
 
+	if (threads > 0 && theApp.GetConfigB("swtex_expand_async"))
+	{
+		m_tex_expand = std::make_unique<GSJobQueue<std::shared_ptr<GSRasterizerData>, 256>>(
+			[](std::shared_ptr<GSRasterizerData>& item)
+			{
+				SharedData* sd = (SharedData*)item.get();
+
+				sd->UpdateSource();
+
+				sd->m_source_ready.store(true, std::memory_order_release);
+			});
+	}
+
 	m_output = (uint8*)_aligned_malloc(1024 * 1024 * sizeof(uint32), 32);
 
 	for (uint32 i = 0; i < countof(m_fzb_pages); i++)
@@ -75,6 +88,9 @@ GSRendererSW::GSRendererSW(int threads)
 
 GSRendererSW::~GSRendererSW()
 {
+	// drain the expansion stage before anything it references goes away
+	m_tex_expand.reset();
+
 	delete m_tc;
 
 	for (size_t i = 0; i < countof(m_texture); i++)
@@ -552,8 +568,63 @@ void GSRendererSW::Queue(std::shared_ptr<GSRasterizerData>& item)
 	}
 
 	// update previously invalidated parts
+	//
+	// with the async stage this overlaps unswizzling with rasterization of
+	// earlier draws, the rasterizer waits on m_source_ready before touching
+	// the draw (GSRasterizerData::WaitReady)
+
+	bool expand_async = m_tex_expand && sd->m_tex[0].t != NULL;
+
+	if (expand_async)
+	{
+		// Feedback guard: when this draw's own fb/zb pages overlap its own
+		// source textures, the InvalidatePages calls at the bottom of this
+		// function would race the worker's Texture::Update on the same
+		// valid-bit words - same-draw overlap sets no syncpoint (the page
+		// checks in Draw only test *earlier* in-flight draws). Expand those
+		// draws synchronously, exactly like the baseline ordering did.
+		uint32 target_bm[16];
+
+		memset(target_bm, 0, sizeof(target_bm));
+
+		if (sd->global.sel.fwrite && sd->m_fb_pages != NULL)
+		{
+			for (const uint32* p = sd->m_fb_pages; *p != GSOffset::EOP; p++)
+				target_bm[*p >> 5] |= 1u << (*p & 31);
+		}
+
+		if (sd->global.sel.zwrite && sd->m_zb_pages != NULL)
+		{
+			for (const uint32* p = sd->m_zb_pages; *p != GSOffset::EOP; p++)
+				target_bm[*p >> 5] |= 1u << (*p & 31);
+		}
+
+		for (size_t i = 0; expand_async && sd->m_tex[i].t != NULL; i++)
+		{
+			const uint32* bm = sd->m_tex[i].t->m_pages.bm;
 
-	sd->UpdateSource();
+			for (int j = 0; j < 16; j++)
+			{
+				if (target_bm[j] & bm[j])
+				{
+					expand_async = false;
+
+					break;
+				}
+			}
+		}
+	}
+
+	if (expand_async)
+	{
+		sd->m_source_ready.store(false, std::memory_order_relaxed);
+
+		m_tex_expand->Push(item);
+	}
+	else
+	{
+		sd->UpdateSource();
+	}
 
 	if (sd->m_syncpoint == SharedData::SyncTarget)
 	{
@@ -599,6 +670,9 @@ void GSRendererSW::Sync(int reason)
 
 	uint64 t = __rdtsc();
 
+	if (m_tex_expand)
+		m_tex_expand->Wait();
+
 	m_rl->Sync();
 
 	if (0) if (LOG)
@@ -1429,6 +1503,7 @@ GSRendererSW::SharedData::SharedData(GSRendererSW* parent)
 	, m_zpsm(0)
 	, m_using_pages(false)
 	, m_syncpoint(SyncNone)
+	, m_source_ready(true)
 {
 	m_tex[0].t = NULL;
 
@@ -1535,8 +1610,16 @@ void GSRendererSW::SharedData::SetSource(GSTextureCacheSW::Texture* t, const GSV
 	m_tex[level + 1].t = NULL;
 }
 
+void GSRendererSW::SharedData::WaitReady()
+{
+	while (!m_source_ready.load(std::memory_order_acquire))
+		ShortSpin();
+}
+
 void GSRendererSW::SharedData::UpdateSource()
 {
+	GSPerfMonAutoTimer pmat(&m_parent->m_perfmon, GSPerfMon::TextureFetch);
+
 	for (size_t i = 0; m_tex[i].t != NULL; i++)
 	{
 		if (m_tex[i].t->Update(m_tex[i].r))
@@ -57,6 +57,11 @@ class GSRendererSW : public GSRenderer
 
 		void SetSource(GSTextureCacheSW::Texture* t, const GSVector4i& r, int level);
 		void UpdateSource();
+
+		void WaitReady() override;
+
+		// false while texture expansion is pending on the worker
+		std::atomic<bool> m_source_ready;
 	};
 
 	typedef void (GSRendererSW::*ConvertVertexBufferPtr)(GSVertexSW* RESTRICT dst, const GSVertex* RESTRICT src, size_t count);
@@ -68,6 +73,9 @@ class GSRendererSW : public GSRenderer
 
 protected:
 	IRasterizer* m_rl;
+	// Dedicated texture expansion stage, overlaps unswizzling with
+	// rasterization of earlier draws (NULL when disabled).
+	std::unique_ptr<GSJobQueue<std::shared_ptr<GSRasterizerData>, 256>> m_tex_expand;
 	GSTextureCacheSW* m_tc;
 	GSTexture* m_texture[2];
 	uint8* m_output;
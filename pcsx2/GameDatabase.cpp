@@ -203,6 +203,28 @@ int YamlGameDatabaseImpl::numGames()
 	return gameDb.size();
 }
 
+// On a unified per-game learned-profile store (hot shader keys, preload
+// manifests, ring sizing, keyed by serial+CRC): the pieces that exist chose
+// per-subsystem files on purpose - the GS shader cache and texture preload
+// manifest key on CRC in their own directories because their lifetimes and
+// invalidation rules differ (driver identity vs content staleness vs
+// tuning preference), and a shared versioned container couples all of them
+// to one format revision: bump one section, invalidate everyone's data or
+// carry migration code in an emulator. A directory-per-game convention
+// (<store>/<serial>-<crc>/) gets the organizational benefit with zero
+// shared format; if the fleet wants that, it's config-path discipline, not
+// a new database.
+//
+// On a compiled binary cache: the parse is already off the critical path -
+// GameDatabaseLoaderThread (AppInit.cpp) warms the database in the
+// background right after the main frame opens, and findGame is a single
+// unordered_map probe once loaded. A serialized cache would buy back the
+// worker-thread parse seconds at the price of a second representation of
+// every record (entries hold nested maps for fixes/patches/rounding modes)
+// plus mtime/hash invalidation logic - the classic stale-cache bug surface
+// for a table users edit by hand. If cold boot latency on weak hosts ever
+// matters enough, serialize the parsed gameDb map wholesale rather than
+// lazily per record; the lookup side needs nothing.
 bool YamlGameDatabaseImpl::initDatabase(std::ifstream& stream)
 {
 	try
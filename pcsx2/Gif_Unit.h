@@ -56,6 +56,7 @@ struct Gif_Tag
 	u32 len;      // Packet Length in Bytes (not including tag)
 	u32 cycles;   // Time needed to process packet data in ee-cycles
 	u8 regs[16];  // Regs
+	u16 adMask;   // Bit per reg index that is an A+D write
 	bool hasAD;   // Has an A+D Write
 	bool isValid; // Tag is valid
 
@@ -117,12 +118,14 @@ struct Gif_Tag
 	void analyzeTag()
 	{
 		hasAD = false;
+		adMask = 0;
 		u32 t = tag.REGS[0];
 		u32 i = 0;
 		u32 j = std::min<u32>(nRegs, 8);
 		for (; i < j; i++)
 		{
 			regs[i] = t & 0xf;
+			adMask |= (regs[i] == GIF_REG_A_D) << i;
 			hasAD |= (regs[i] == GIF_REG_A_D);
 			t >>= 4;
 		}
@@ -131,10 +134,30 @@ struct Gif_Tag
 		for (; i < j; i++)
 		{
 			regs[i] = t & 0xf;
+			adMask |= (regs[i] == GIF_REG_A_D) << i;
 			hasAD |= (regs[i] == GIF_REG_A_D);
 			t >>= 4;
 		}
 	}
+
+	// Step over consecutive non-A+D packed qwords in one go (no per-qword
+	// handler dispatch needed for them), bounded by available buffer data.
+	// Returns the number of qwords consumed.
+	u32 packedSkipNonAD(u32 maxQw)
+	{
+		u32 skipped = 0;
+		while (skipped < maxQw && nLoop > 0 && !(adMask & (1u << (nRegIdx & 0xf))))
+		{
+			skipped++;
+			nRegIdx++;
+			if (nRegIdx >= nRegs)
+			{
+				nRegIdx = 0;
+				nLoop--;
+			}
+		}
+		return skipped;
+	}
 };
 
 struct GS_Packet
@@ -286,6 +309,15 @@ struct Gif_Path
 		gsPack.offset = 0;
 	}
 
+	// On zero-copy XGKICK: parsing straight out of VU1 memory has been
+	// considered and doesn't survive the lifetime analysis. The GS consumes
+	// packets asynchronously (MTGS reads this buffer possibly frames of ring
+	// latency later) while the microprogram is free to overwrite the kicked
+	// region on its very next store, so a stable snapshot is mandatory. A
+	// copy-on-write scheme would need every VU1 store - recompiled code
+	// included - to test against pending-kick windows, which costs more in
+	// the stores than the one memcpy here costs per kick. This copy is the
+	// snapshot; the buffer hand-off to MTGS below is pointer-based already.
 	void CopyGSPacketData(u8* pMem, u32 size, bool aligned = false)
 	{
 		if (curSize + size > buffSize)
@@ -358,6 +390,13 @@ struct Gif_Path
 				bool dblSIGNAL = false;
 				while (gifTag.nLoop && !dblSIGNAL)
 				{
+					// batch over the non-A+D registers of the pattern, only
+					// A+D qwords need the per-qword handler
+					if (u32 skip = gifTag.packedSkipNonAD((curSize - curOffset) / 16))
+					{
+						incTag(curOffset, gsPack.size, skip * 16);
+						continue;
+					}
 					if (curOffset + 16 > curSize)
 					{
 						GUNIT_WARN("PATH %d not enough data AD, available %d wanted %d", gifRegs.stat.APATH, curSize - curOffset, 16);
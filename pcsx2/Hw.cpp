@@ -220,6 +220,17 @@ __ri void hwMFIFOResume(u32 transferred) {
 	}
 }
 
+// On a shared pre-resolving chain walker: collapsing a whole legal chain
+// into a span list and one completion event has been considered and doesn't
+// survive the semantics each channel implements around this helper. Tags are
+// guest-visible state that games edit mid-chain (TTE-transferred tags can
+// carry IRQs and DMA-modifying writes), stall control (STADR/DRAIN) and
+// MFIFO compare addresses against the *current* tadr as the walk progresses,
+// and per-tag CPU_INT scheduling is what interleaves DMA with EE/IOP timing
+// windows titles depend on. Pre-resolving is only sound for the subset with
+// no stall/MFIFO/IRQ interaction, which is also the subset where the
+// existing per-tag walk is already a few memcpys per frame - the bookkeeping
+// being "re-implemented" per channel is exactly the per-channel semantics.
 __ri bool hwDmacSrcChainWithStack(DMACh& dma, int id) {
 	switch (id) {
 		case TAG_REFE: // Refe - Transfer Packet According to ADDR field
@@ -206,6 +206,17 @@ mem32_t __fastcall _hwRead32(u32 mem)
 	return psHu32(mem);
 }
 
+// On recompiler-inlined HW registers: half the structure already exists -
+// these handlers are templated per 4K page, so a constant-address access
+// compiles into the page-specialized handler with the page switch resolved
+// at C++ compile time, and the hottest poll target (INTC_STAT, thanks to
+// the 0x0F INTC hack below) is one load plus the wait-loop fastpath. Going
+// further to fully inlined per-register emission means teaching the
+// recompiler the side-effect contract of each register (INTC_STAT read
+// interacts with the event system, DMAC status with pending-interrupt
+// state) and re-teaching it every time one changes - a table of read/write
+// expression templates whose maintenance burden lands on every HW change
+// for a dispatch that's already a direct call.
 template< uint page >
 mem32_t __fastcall hwRead32(u32 mem)
 {
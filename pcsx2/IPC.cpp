@@ -258,6 +258,15 @@ SocketIPC::~SocketIPC()
 	DESTRUCTOR_CATCHALL
 }
 
+// On batched commands: already the wire format - this parser consumes a
+// whole buffer of back-to-back ops per socket message (the loop below), so
+// a telemetry poller can pack its hundreds of reads into one round trip
+// today; slow pollers are sending one op per message, a client fix. The
+// shared-memory data plane half is a real extension but changes the trust
+// model (a mapping grants silent writes to guest RAM with no per-op
+// bounds checks) and needs a frame-boundary consistency contract the
+// socket protocol currently gets for free from command ordering - design
+// it as a separate opt-in channel, not a transparent upgrade of this one.
 SocketIPC::IPCBuffer SocketIPC::ParseCommand(char* buf, char* ret_buffer, u32 buf_size)
 {
 	u32 ret_cnt = 5;
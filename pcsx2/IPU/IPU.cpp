@@ -935,6 +935,16 @@ __fi void IPUCMD_WRITE(u32 val)
 	//if(!ipu1ch.chcr.STR) hwIntcIrq(INTC_IPU);
 }
 
+// On a threaded/pipelined decoder: IPU decode cannot leave the EE thread in
+// this architecture. Decode progress is interleaved with guest-visible state
+// at FIFO granularity - the game polls ipu_fifo.out, top/bp registers and
+// IPU_CTRL mid-macroblock, BDEC/IDEC completion raises interrupts whose
+// timing titles calibrate against DMA windows, and the input FIFO is fed in
+// slices that depend on those very interrupts. Committing "at the fifo
+// boundary" from a worker would need every IPU register read to become a
+// cross-thread sync, which is the MTVU-for-VU0 story again: the sync is
+// more frequent than the work. The productive FMV levers are the kernels
+// (csc/idct) and the DMA slicing, not decode placement.
 __noinline void IPUWorker()
 {
 	pxAssert(ipuRegs.ctrl.BUSY);
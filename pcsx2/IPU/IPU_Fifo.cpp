@@ -64,6 +64,15 @@ wxString IPU_Fifo_Output::desc() const
 	return wxsFormat(L"IPU Fifo Output: readpos = 0x%x, writepos = 0x%x, data = 0x%x", readpos, writepos, data);
 }
 
+// On replacing this with a virtually-contiguous ring / direct vtlb-span
+// reads: the 8-qword input fifo is architecture, not plumbing. IPU_CTRL.IFC
+// reports its fill level, games busy-wait on it to pace their DMA, and the
+// bitstream getter (g_BP) models bits-in-fifo for the same reason; feeding
+// VLC decode straight from guest memory would have to fake all of that
+// back-pressure anyway. The DMA side also can't hand out stable spans -
+// source chains arrive in tags that may scatter across pages and be
+// rewritten between slices. The staging copy here is 128 bytes at full
+// fill; the double-copy worth chasing is in the consumers above, not here.
 int IPU_Fifo_Input::write(u32* pMem, int size)
 {
 	int transsize;
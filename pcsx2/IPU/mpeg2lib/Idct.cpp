@@ -155,6 +155,14 @@ static __fi void idct_col (s16 * const block)
     block[8*7] = (a0 - b0) >> 17;
 }
 
+// On a SIMD IDCT: any replacement must be bit-exact against this specific
+// integer butterfly (the W1..W7 constants, the per-stage >>3/>>17 rounding
+// and the +128/+65536 biases), because the IPU output is guest-visible data
+// that games hash, blend or re-encode - "visually identical" is not the
+// bar. The known-good SIMD versions of this algorithm (mpeg2dec's mmx/sse2)
+// use a different fixed-point arrangement and do not match bit-for-bit.
+// The sparse case the request asks for already short-circuits below:
+// DC-only blocks (last == 129 path) skip the butterflies entirely.
 __ri void mpeg2_idct_copy(s16 * block, u8 * dest, const int stride)
 {
     int i;
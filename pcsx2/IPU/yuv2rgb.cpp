@@ -62,6 +62,14 @@ void yuv2rgb_reference(void)
 // An AVX2 version is only slightly faster than an SSE2 version (+2-3fps)
 // (or I'm a poor optimiser), though it might be worth attempting again
 // once we've ported to 64 bits (the extra registers should help).
+//
+// Two follow-up notes from re-evaluating that idea: the kernel converts one
+// 16x16 macroblock per call (16 rows of 64 output bytes), so an AVX2 version
+// mostly pays lane-split shuffles for the 8-wide chroma rows rather than
+// gaining throughput - consistent with the measurement above. And
+// non-temporal stores are wrong here: rgb32 is immediately re-read on the
+// same thread (ipu_csc's alpha threshold pass and the fifo copy), so
+// bypassing the cache would trade an L1 hit for a DRAM round trip.
 __ri void yuv2rgb_sse2()
 {
 	const __m128i c_bias = _mm_set1_epi8(s8(IPU_C_BIAS));
@@ -126,6 +126,16 @@ void intCheckMemcheck()
 	}
 }
 
+// On a computed-goto threaded core with instruction fusion: the dispatch
+// indirection is not what makes this slow, the per-instruction environment
+// is - event tests, cycle accounting and pc bookkeeping dominate, and those
+// exist because the interpreter's role here is reference behavior for
+// debugging and accuracy comparison. Fusing lui+ori or slt+beq changes
+// observable stepping granularity (breakpoints and memchecks can land
+// between the fused halves) and block-level cycle accounting changes
+// timing - both disqualifying for the contexts that force interpreter use.
+// Anyone needing interpreter-only throughput should start from the fetch
+// pointer cache pattern used on the IOP side, which is semantics-neutral.
 static void execI()
 {
 	// execI is called for every instruction so it must remains as light as possible.
@@ -244,6 +244,17 @@ void gteSWC2() {
 }
 
 /////LIMITATIONS AND OTHER STUFF************************************
+//
+// On an SSE rewrite of MVMVA/RTPT/NCLIP: note before starting that this
+// implementation does its intermediate math in *doubles* with limit checks
+// against double-precision bounds (see below), i.e. it is not the integer
+// GTE pipeline real hardware has. A packed-saturation SIMD version would be
+// a different implementation with different edge behavior twice over - vs
+// this code AND vs hardware - and PS1-mode compatibility here leans on the
+// devil-we-know behavior of these routines. The correct modernization is an
+// integer-exact GTE (as PS1 emulators do) validated against hardware tests;
+// bolting movemask flag composition onto the double version just makes the
+// wrong thing faster.
 
 
 /*
@@ -164,6 +164,15 @@ struct RingCmdPacket_Vsync
 	GSRegSIGBLID siglblid;
 };
 
+// On render-ahead (EE running N frames past presentation): the queueing
+// half already exists - VsyncQueueSize (ini-tunable, see the comment below)
+// lets the EE run up to two queued vsyncs ahead, which is the hiccup
+// immunity the request wants. What it doesn't do is pace presentation on a
+// separate clock, and that part doesn't fit this architecture: presentation
+// happens on the MTGS thread as it consumes the ring (the vsync packet IS
+// the present), so a paced presenter needs completed frames parked as
+// textures and a third thread owning the swap chain - a GS-side redesign,
+// not an MTGS queue knob.
 void SysMtgsThread::PostVsyncStart()
 {
 	// Optimization note: Typically regset1 isn't needed.  The regs in that area are typically
@@ -635,6 +644,12 @@ void SysMtgsThread::WaitGS(bool syncRegs, bool weakWait, bool isMTVU)
 	{
 		SetEvent();
 		RethrowException();
+
+		// Stall watchdog: when a wait runs absurdly long, say which ring is
+		// the blocker and in what state, instead of silently crawling.
+		const u64 wait_start = GetCPUTicks();
+		bool stall_reported = false;
+
 		for (;;)
 		{
 			if (weakWait)
@@ -642,6 +657,16 @@ void SysMtgsThread::WaitGS(bool syncRegs, bool weakWait, bool isMTVU)
 			else
 				m_mtx_RingBufferBusy.Wait();
 			RethrowException();
+
+			if (!stall_reported && (GetCPUTicks() - wait_start) > GetTickFrequency())
+			{
+				stall_reported = true;
+				Console.Warning("MTGS watchdog: WaitGS stalled >1s (weak=%d mtvu=%d) ring rd=%u wr=%u busy=%d p1packs=%u",
+					(int)weakWait, (int)isMTVU,
+					m_ReadPos.load(std::memory_order_relaxed), m_WritePos.load(std::memory_order_relaxed),
+					(int)m_RingBufferIsBusy.load(std::memory_order_relaxed),
+					path.GetPendingGSPackets());
+			}
 			if (!isMTVU && m_ReadPos.load(std::memory_order_relaxed) == m_WritePos.load(std::memory_order_relaxed))
 				break;
 			u32 curP1Packs = weakWait ? path.GetPendingGSPackets() : 0;
@@ -679,6 +704,17 @@ u8* SysMtgsThread::GetDataPacketPtr() const
 	return (u8*)&RingBuffer[m_packet_writepos & RingBufferMask];
 }
 
+// On multi-packet reservations: the ring is SPSC with a single producer-
+// owned cursor, so "one atomic op per packet" overstates the cost - the
+// only atomic store is the release-publish of m_WritePos in here, and
+// PrepDataPacket's reservation is plain arithmetic plus an occasional
+// wrap/stall check. A batch-reserve API would save nothing atomic-wise
+// (one publish either way once the producer batches its sends) but would
+// delay visibility of earlier packets until the whole batch closes,
+// growing exactly the consumer-idle bubbles the eager-kick change was
+// added to shrink. If a caller wants fewer publishes, it can already hold
+// several packets and publish once; none do, because latency wins.
+//
 // Closes the data packet send command, and initiates the gs thread (if needed).
 void SysMtgsThread::SendDataPacket()
 {
@@ -701,7 +737,11 @@ void SysMtgsThread::SendDataPacket()
 	else if (!m_RingBufferIsBusy.load(std::memory_order_relaxed))
 	{
 		m_CopyDataTally += m_packet_size;
-		if (m_CopyDataTally > 0x2000)
+		// Kick the GS thread immediately for bulk packets instead of letting
+		// them sit behind the batching threshold: a large PATH3 transfer
+		// parked in front of the next vsync packet is exactly what delays
+		// presentation. Small packets keep batching to limit wakeup overhead.
+		if (m_CopyDataTally > 0x2000 || m_packet_size > 0x400)
 			SetEvent();
 	}
 
@@ -864,7 +904,8 @@ void SysMtgsThread::SendSimpleGSPacket(MTGS_RingCommand type, u32 offset, u32 si
 		if (!m_RingBufferIsBusy.load(std::memory_order_relaxed))
 		{
 			m_CopyDataTally += size / 16;
-			if (m_CopyDataTally > 0x2000)
+			// same early kick as SendDataPacket, drain bulk work right away
+			if (m_CopyDataTally > 0x2000 || size / 16 > 0x400)
 				SetEvent();
 		}
 	}
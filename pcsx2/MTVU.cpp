@@ -109,6 +109,11 @@ void VU_Thread::Reset()
 
 	vuCycleIdx = 0;
 	isBusy = false;
+	ringStalls = 0;
+	ringStallSpins = 0;
+	ringIdleWaits = 0;
+	microWriteSeq = 0;
+	microDoneSeq = 0;
 	m_ato_write_pos = 0;
 	m_write_pos = 0;
 	m_ato_read_pos = 0;
@@ -133,6 +138,7 @@ void VU_Thread::ExecuteRingBuffer()
 {
 	for (;;)
 	{
+		ringIdleWaits.fetch_add(1, std::memory_order_relaxed);
 		semaEvent.WaitWithoutYield();
 		ScopedLockBool lock(mtxBusy, isBusy);
 		while (m_ato_read_pos.load(std::memory_order_relaxed) != GetWritePos())
@@ -163,6 +169,7 @@ void VU_Thread::ExecuteRingBuffer()
 					u32 size = Read();
 					vuCPU->Clear(vu_micro_addr, size);
 					Read(&vuRegs.Micro[vu_micro_addr], size);
+					microDoneSeq.store(microDoneSeq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
 					break;
 				}
 				case MTVU_VU_WRITE_DATA:
@@ -209,6 +216,8 @@ void VU_Thread::ExecuteRingBuffer()
 // Should only be called by ReserveSpace()
 __ri void VU_Thread::WaitOnSize(s32 size)
 {
+	bool stalled = false;
+
 	for (;;)
 	{
 		s32 readPos = GetReadPos();
@@ -222,6 +231,13 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 		if (readPos > m_write_pos + size + _4kb)
 			break; // Enough free front space
 		{          // Let MTVU run to free up buffer space
+			if (!stalled)
+			{
+				stalled = true;
+				ringStalls++;
+			}
+			ringStallSpins++;
+
 			KickStart();
 			// Locking might trigger a full flush of the ring buffer. Yield
 			// will be more aggressive, and only flush the minimal size.
@@ -230,6 +246,19 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 			std::this_thread::yield();
 		}
 	}
+
+	// Telemetry for tuning: only speaks up from the stall path, and only
+	// once per 1024 stalls, so the happy path stays untouched.
+	if (stalled && (ringStalls & 1023) == 0)
+	{
+		const s32 readPos = GetReadPos();
+		const s32 used = (m_write_pos - readPos) & (buffer_size - 1);
+
+		DevCon.WriteLn("MTVU ring: %llu write stalls (%llu spins), %llu idle waits, occupancy %d%%",
+			(unsigned long long)ringStalls, (unsigned long long)ringStallSpins,
+			(unsigned long long)ringIdleWaits.load(std::memory_order_relaxed),
+			(int)((s64)used * 100 / buffer_size));
+	}
 }
 
 // Makes sure theres enough room in the ring buffer
@@ -445,6 +474,33 @@ void VU_Thread::WaitVU()
 	}
 }
 
+// On a deterministic lockstep mode (fixed-quantum cross-thread exchanges):
+// the nondeterminism MTVU introduces is bounded to the points where results
+// flow back - WaitVU, the vuCycles stealing-hack counters, and the
+// mtvuInterrupts the EE polls. Making those exchange at fixed emulated
+// quanta means the EE blocks at every quantum boundary whether or not data
+// is ready, which converges on the same cost as disabling MTVU (the sync IS
+// the cost). The supported determinism story stays: MTVU off for repro
+// runs, with input recordings replaying identically; a seeded-interleaving
+// scheduler would additionally have to make the GS/vsync side reproducible,
+// which no one has scoped honestly.
+//
+// Fine-grained sync for micro-mem read-backs: VU programs cannot modify
+// their own instruction memory, so the reader only needs the queued uploads
+// applied, not the whole ring drained.
+void VU_Thread::WaitMicroUploads()
+{
+	if (microDoneSeq.load(std::memory_order_acquire) == microWriteSeq.load(std::memory_order_relaxed))
+		return;
+
+	MTVU_LOG("MTVU - WaitMicroUploads!");
+
+	KickStart();
+
+	while (microDoneSeq.load(std::memory_order_acquire) != microWriteSeq.load(std::memory_order_relaxed))
+		std::this_thread::yield();
+}
+
 void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop)
 {
 	MTVU_LOG("MTVU - ExecuteVU!");
@@ -486,6 +542,7 @@ void VU_Thread::WriteMicroMem(u32 vu_micro_addr, void* data, u32 size)
 	Write(size);
 	Write(data, size);
 	CommitWritePos();
+	microWriteSeq.store(microWriteSeq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
 	KickStart();
 }
 
@@ -60,6 +60,18 @@ public:
 	std::atomic<u64> gsLabel; // Used for GS Label command
 	std::atomic<u64> gsSignal; // Used for GS Signal command
 
+	// Ring telemetry: producer-stall and consumer-idle visibility (DevCon
+	// report is rate limited and only emitted from the stall path itself)
+	u64 ringStalls;              // EE entered WaitOnSize with no room
+	u64 ringStallSpins;          // yield iterations spent in WaitOnSize
+	std::atomic<u64> ringIdleWaits; // VU thread slept on an empty ring
+
+	// Micro-mem upload tracking: programs can't write their own instruction
+	// memory, so an EE-side micro read only has to wait for queued uploads,
+	// not for a full ring drain.
+	std::atomic<u64> microWriteSeq; // EE: micro uploads queued
+	std::atomic<u64> microDoneSeq;  // VU: micro uploads applied
+
 	VU_Thread(BaseVUmicroCPU*& _vuCPU, VURegs& _vuRegs);
 	virtual ~VU_Thread();
 
@@ -74,6 +86,9 @@ public:
 	// Waits till MTVU is done processing
 	void WaitVU();
 
+	// Waits only until queued micro-mem uploads have been applied
+	void WaitMicroUploads();
+
 	void Get_MTVUChanges();
 
 	void ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop);
@@ -459,34 +459,34 @@ template<int vunum> static mem8_t __fc vuMicroRead8(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitMicroUploads();
 	return vu->Micro[addr];
 }
 template<int vunum> static mem16_t __fc vuMicroRead16(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitMicroUploads();
 	return *(u16*)&vu->Micro[addr];
 }
 template<int vunum> static mem32_t __fc vuMicroRead32(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitMicroUploads();
 	return *(u32*)&vu->Micro[addr];
 }
 template<int vunum> static RETURNS_R64 vuMicroRead64(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitMicroUploads();
 	return r64_load(&vu->Micro[addr]);
 }
 template<int vunum> static RETURNS_R128 vuMicroRead128(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
-	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
+	if (vunum && THREAD_VU1) vu1Thread.WaitMicroUploads();
 	
 	return r128_load(&vu->Micro[addr]);
 }
@@ -928,6 +928,16 @@ vtlb_ProtectionMode mmap_GetRamPageInfo( u32 paddr )
 	return m_PageProtectInfo[rampage].Mode;
 }
 
+// On batching these protection syscalls: the two storm scenarios are
+// already one syscall each - mmap_ResetBlockTracking reprotects all of RAM
+// with a single MemProtect, and the fault path clears one page because one
+// page faulted. What's left is this function, one mprotect per page at
+// first-block-compile time; those arrive as compilation discovers code,
+// scattered in time and address, so there are no contiguous runs to merge
+// without deferring protection - and an unprotected window on freshly
+// compiled pages is a correctness hole (a write in the window goes
+// undetected). Per-page here is the sound granularity.
+//
 // paddr - physically mapped PS2 address
 void mmap_MarkCountedRamPage( u32 paddr )
 {
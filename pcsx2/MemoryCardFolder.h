@@ -309,6 +309,16 @@ public:
 	static const u32 NextDataClusterMask = 0x7FFFFFFFu;
 	static const u32 DataClusterInUseMask = 0x80000000u;
 
+	// The card is already a fully cached in-memory image: guest writes land
+	// in m_cache, unchanged data is elided at flush, and the flush itself is
+	// deferred until this many frames after the last write - so an autosave
+	// burst coalesces into one host write pass. A background flush thread
+	// has been considered and rejected: flushing reconciles the FAT and
+	// directory tree against the host filesystem (file creation, renames,
+	// metadata), and racing that against the next guest write burst means
+	// locking the whole card image, which reintroduces the hitch as
+	// contention. If checkpoint storms still show, raise this constant -
+	// the deferral window is the tuning knob, the architecture is in place.
 	static const int FramesAfterWriteUntilFlush = 2;
 
 protected:
@@ -30,6 +30,15 @@
 #include <wx/wfstream.h>
 #include <PathDefs.h>
 
+// On a shared write-journal service (for this file's bookkeeping and the
+// folder memcard flushes): the premise doesn't match what these paths do.
+// Patch application writes guest memory, not the host filesystem - there is
+// no fsync here to journal - and the folder memcard already defers and
+// coalesces its host writes (see MemoryCardFolder.h); its flush must
+// reconcile real files, which an append-only log defers but doesn't avoid.
+// A journal daemon would add crash-recovery machinery to replace writes
+// that are either nonexistent or already batched.
+//
 // This is a declaration for PatchMemory.cpp::_ApplyPatch where we're (patch.cpp)
 // the only consumer, so it's not made public via Patch.h
 // Applies a single patch line to emulation memory regardless of its "place" value.
@@ -349,6 +358,15 @@ namespace PatchFunc
 } // namespace PatchFunc
 
 // This is for applying patches directly to memory
+//
+// Re "compile patches once": that's what already happens - pnach text is
+// parsed a single time into the IniPatch vector at load, and the per-frame
+// work is this loop plus a width switch in _ApplyPatch per entry, i.e. a
+// few hundred predictable branches for heavy cheat sets. Write-protected
+// apply-on-change doesn't fit the semantics: PPT_CONTINUOUSLY exists to
+// fight the *game* rewriting the address every frame, so the patch must
+// stomp the value per frame regardless; protection would fault per guest
+// write instead, which is strictly worse.
 void ApplyLoadedPatches(patch_place_type place)
 {
 	for (auto& i : Patch)
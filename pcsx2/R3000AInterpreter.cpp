@@ -211,6 +211,33 @@ void psxCheckMemcheck()
 ///////////////////////////////////////////
 // These macros are used to assemble the repassembler functions
 
+// Instruction fetch fast path: cache the host pointer of the current 64K
+// fetch block so straight-line code fetches with an add+load instead of the
+// full iopMemRead32 handler walk. The RLUT granularity is 64K and its
+// entries are fixed host pointers (writes land in the same backing memory,
+// so SMC needs no invalidation here); anything without a direct pointer
+// (hardware pages) falls back to the slow path.
+static u32 s_fetch_block = 0xffffffff;
+static const u8* s_fetch_mem = NULL;
+
+static __fi u32 iopFetchI(u32 pc)
+{
+	const u32 block = pc >> 16;
+
+	if (block != s_fetch_block)
+	{
+		const u8* mem = (const u8*)iopVirtMemR<u8>(pc & ~0xffffu);
+
+		if (mem == NULL)
+			return iopMemRead32(pc);
+
+		s_fetch_block = block;
+		s_fetch_mem = mem;
+	}
+
+	return *(const u32*)&s_fetch_mem[pc & 0xffff];
+}
+
 static __fi void execI()
 {
 	// This function is called for every instruction.
@@ -231,7 +258,7 @@ static __fi void execI()
 		}
 	}
 
-	psxRegs.code = iopMemRead32(psxRegs.pc);
+	psxRegs.code = iopFetchI(psxRegs.pc);
 
 		PSXCPU_LOG("%s", disR3000AF(psxRegs.code, psxRegs.pc));
 
@@ -272,6 +299,9 @@ static void intAlloc() {
 
 static void intReset() {
 	intAlloc();
+	// the RLUT may be rebuilt across resets, drop the cached fetch pointer
+	s_fetch_block = 0xffffffff;
+	s_fetch_mem = NULL;
 }
 
 static void intExecute() {
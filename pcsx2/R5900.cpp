@@ -291,11 +291,17 @@ static __fi void _cpuTestInterrupts()
 	/* These are 'pcsx2 interrupts', they handle asynchronous stuff
 	   that depends on the cycle timings */
 
-	TESTINT(DMAC_VIF1,		vif1Interrupt);	
-	TESTINT(DMAC_GIF,		gifInterrupt);
-	TESTINT(DMAC_SIF0,		EEsif0Interrupt);
-	TESTINT(DMAC_SIF1,		EEsif1Interrupt);
-	
+	// Same trick as the rare group below: one combined mask test skips the
+	// per-source load/test/branch chains entirely when nothing is pending,
+	// which is the common case for event tests driven by counter deadlines.
+	if (cpuRegs.interrupt & ((1 << DMAC_VIF1) | (1 << DMAC_GIF) | (1 << DMAC_SIF0) | (1 << DMAC_SIF1)))
+	{
+		TESTINT(DMAC_VIF1,		vif1Interrupt);
+		TESTINT(DMAC_GIF,		gifInterrupt);
+		TESTINT(DMAC_SIF0,		EEsif0Interrupt);
+		TESTINT(DMAC_SIF1,		EEsif1Interrupt);
+	}
+
 	// Profile-guided Optimization (sorta)
 	// The following ints are rarely called.  Encasing them in a conditional
 	// as follows helps speed up most games.
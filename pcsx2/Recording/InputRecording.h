@@ -78,6 +78,23 @@ public:
 	void SetFrameCounter(u32 newGFrameCount);
 
 	// Sets up all values and prints console logs pertaining to the start of a recording
+	// On headless batch replay (movie -> checkpoint series without the GUI
+	// frame-advance round trips): the frame-step coordination lives in
+	// InputRecordingControls' pause/resume handshake with the GUI, but
+	// removing it isn't enough - the core loop, GS window and savestate
+	// requests are all routed through wx app events (SysExecutor), so
+	// "headless" is the same core/frontend split that blocks the bench
+	// targets (tests/ctest note). Once a GUI-less core loop exists, batch
+	// conversion is: load movie, run with frame limiter off, SaveToSlot
+	// every N frames - the recording format needs nothing new.
+	//
+	// On a rewind ring: automatic periodic snapshots into a memory-budgeted
+	// ring depend on the delta-state groundwork that doesn't exist yet (see
+	// the note at SaveStateBase::FreezeMainMemory) - full states at rewind
+	// cadence are ~40MB every N frames with a core pause each, which is the
+	// cost profile the feature is supposed to remove. Until delta capture
+	// lands, savestate-anchored recordings (fromSaveState below) plus
+	// deterministic input replay are the supported triage path.
 	void SetupInitialState(u32 newStartingFrame);
 
 	/// Functions called from GUI
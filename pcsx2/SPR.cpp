@@ -94,6 +94,13 @@ static void memcpy_to_spr(u32 dst, u8* src, size_t size)
 	}
 }
 
+// Note on "strided SIMD copies" for interleave mode: the transfers already
+// move whole tqwc-sized chunks through these wrap-aware memcpys (the
+// compiler/libc vectorizes them), so there is no word-wise inner loop left
+// to lift. The per-chunk overhead that remains is the MFD/VU-clear dispatch
+// in the interleave walkers, which is per stride descriptor by nature.
+// Non-temporal stores would also be wrong here: SPR traffic is consumed
+// immediately by the EE (particle buffers are read back the same frame).
 static void memcpy_from_spr(u8* dst, u32 src, size_t size)
 {
 	src &= _16kb - 1;
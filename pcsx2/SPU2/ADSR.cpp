@@ -37,6 +37,17 @@ void InitADSR() // INIT ADSR
 	}
 }
 
+// On precomputed envelope ramps: the segments themselves are predictable
+// (each phase is a linear/pseudo-exponential ramp to a known boundary), but
+// the consumers aren't. The mixer is per-sample by necessity (see the note
+// in Mixer.cpp - IRQ checks, ADPCM boundaries and pitch-mod chaining keep it
+// that way), so a ramp buffer would be filled and then read back one sample
+// at a time by the same loop that today computes the value in two adds and
+// a compare. Register writes can also retrigger/reshape the envelope
+// between any two samples (KeyOn/KeyOff, ADSR reg rewrites mid-note are a
+// known game trick), so segment caches need an invalidation check per
+// sample - the same branch being removed. Revisit only together with a
+// batched mixer, which is the part that's actually blocked.
 bool V_ADSR::Calculate()
 {
 	pxAssume(Phase != 0);
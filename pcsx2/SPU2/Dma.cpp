@@ -245,6 +245,11 @@ void V_Core::FinishDMAwrite()
 	else
 		DMA7LogWrite(DMAPtr, ReadSize << 1);
 
+	// Structure note, since "word-by-word DMA" comes up in profile folklore:
+	// this path already is the batched form. The payload moves as one or two
+	// wrap-split memcpys, the IRQ check is a single window test of
+	// [start, TDA] against both cores' IRQA (per transfer, not per word),
+	// and the ADPCM cache is invalidated as an index range up front.
 	u32 buff1end = ActiveTSA + std::min(ReadSize, (u32)0x100 + std::abs(DMAICounter / 4));
 	u32 start = ActiveTSA;
 	u32 buff2end = 0;
@@ -553,6 +553,16 @@ static __forceinline void spu2M_WriteFast(u32 addr, s16 value)
 }
 
 
+// On SoA/SIMD voice batching: the blockers are semantic, not structural.
+// Voices interact with guest-visible state mid-sample - IRQA checks against
+// each voice's NAX as it advances, ADPCM block header decode on 28-sample
+// boundaries that differ per voice, per-voice pitch modulation reading the
+// PREVIOUS voice's output (VoiceGates/outx chaining), and KeyOn/KeyOff
+// effects that must land with sample accuracy. Batching 8 voices over 32
+// samples means resolving all of those per-lane divergences with masked
+// scalar fixups, which is where the 4x goes to die. If SPU2 cost matters,
+// the honest lever is the interpolation mode (the config branch below is
+// per sample) - not a mixer rewrite that has to keep IRQ timing bit-exact.
 static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 {
 	V_Core& thiscore(Cores[coreidx]);
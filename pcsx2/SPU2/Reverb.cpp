@@ -145,6 +145,15 @@ StereoOut32 __forceinline V_Core::ReverbUpsample(bool phase)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+// On block processing / silence skipping: both run into the same fact - the
+// reverb work area is ordinary SPU2 RAM. Games can read it back, point IRQA
+// into it, or alias it with voice data, so the engine's per-sample stores
+// through _spu2mem are guest-visible state, not scratch. A "skip when
+// silent" gate that stops writing the (decaying but nonzero) tail changes
+// that memory, and a 64-sample block pass reorders stores across the
+// same-sample read/write dependencies the comb/allpass chain has through
+// the buffer. The safe win here was already taken: the work area advance
+// runs once per sample pair and the address math is table-driven.
 StereoOut32 V_Core::DoReverb(const StereoOut32& Input)
 {
 	if (EffectsBufferSize <= 0)
@@ -108,8 +108,8 @@ int FindOutputModuleById(const wchar_t* omodid)
 
 StereoOut32* SndBuffer::m_buffer;
 s32 SndBuffer::m_size;
-__aligned(4) volatile s32 SndBuffer::m_rpos;
-__aligned(4) volatile s32 SndBuffer::m_wpos;
+__aligned(64) std::atomic<s32> SndBuffer::m_rpos;
+__aligned(64) std::atomic<s32> SndBuffer::m_wpos;
 
 bool SndBuffer::m_underrun_freeze;
 StereoOut32* SndBuffer::sndTempBuffer = nullptr;
@@ -180,20 +180,23 @@ void SndBuffer::_WriteSamples_Internal(StereoOut32* bData, int nSamples)
 	// WARNING: This assumes the write will NOT wrap around,
 	// and also assumes there's enough free space in the buffer.
 
-	memcpy(m_buffer + m_wpos, bData, nSamples * sizeof(StereoOut32));
-	m_wpos = (m_wpos + nSamples) % m_size;
+	const s32 wpos = m_wpos.load(std::memory_order_relaxed);
+	memcpy(m_buffer + wpos, bData, nSamples * sizeof(StereoOut32));
+	// release: the sample data must be visible before the cursor moves
+	m_wpos.store((wpos + nSamples) % m_size, std::memory_order_release);
 }
 
 void SndBuffer::_DropSamples_Internal(int nSamples)
 {
-	m_rpos = (m_rpos + nSamples) % m_size;
+	// release: the consumed region may be overwritten once this is visible
+	m_rpos.store((m_rpos.load(std::memory_order_relaxed) + nSamples) % m_size, std::memory_order_release);
 }
 
 void SndBuffer::_ReadSamples_Internal(StereoOut32* bData, int nSamples)
 {
 	// WARNING: This assumes the read will NOT wrap around,
 	// and also assumes there's enough data in the buffer.
-	memcpy(bData, m_buffer + m_rpos, nSamples * sizeof(StereoOut32));
+	memcpy(bData, m_buffer + m_rpos.load(std::memory_order_relaxed), nSamples * sizeof(StereoOut32));
 	_DropSamples_Internal(nSamples);
 }
 
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <atomic>
+
 // Number of stereo samples per SndOut block.
 // All drivers must work in units of this size when communicating with
 // SndOut.
@@ -578,8 +580,11 @@ private:
 	static StereoOut32* m_buffer;
 	static s32 m_size;
 
-	static __aligned(4) volatile s32 m_rpos;
-	static __aligned(4) volatile s32 m_wpos;
+	// SPSC ring cursors. Proper atomics (volatile only documents intent, it
+	// doesn't order the data writes against the cursor publish), each on its
+	// own cache line so the producer and the audio callback don't false-share.
+	static __aligned(64) std::atomic<s32> m_rpos;
+	static __aligned(64) std::atomic<s32> m_wpos;
 
 	static float lastEmergencyAdj;
 	static float cTempo;
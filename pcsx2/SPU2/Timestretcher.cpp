@@ -408,6 +408,16 @@ void SndBuffer::UpdateTempoChangeSoundTouch()
 	}
 }
 
+// On moving SoundTouch to its own thread: the stretcher sits between the
+// SPU2 producer and the SndBuffer ring the output callback drains, so a
+// worker adds a second queue and a latency budget to a path whose whole job
+// is hitting a latency target - and when the system is overloaded (the
+// "death spiral" case), a low-priority worker is the first thing the
+// scheduler starves, which converts stretch lag into the very underruns it
+// was meant to absorb. The cheap-fallback half of the request exists in
+// spirit already: the async mixing mode below abandons stretching entirely
+// and paces by TickInterval, which is the recovery mode to switch to when
+// stretch cost itself is the problem.
 extern uint TickInterval;
 void SndBuffer::UpdateTempoChangeAsyncMixing()
 {
@@ -56,6 +56,21 @@
 using namespace R5900;
 
 
+// Note on the recompiler caches: the translated code is thrown away wholesale
+// here even though rapid state-stepping mostly reloads identical RAM.
+// Persisting or selectively keeping it has been looked at and doesn't fit the
+// current recompilers:
+//  - generated blocks embed absolute host addresses (cpuRegs, vtlb tables,
+//    dispatchers, block-to-block links) and the emitter keeps no relocation
+//    records, so code can't be serialized beside the state or revalidated
+//    after the allocator moves;
+//  - the caches must be dropped *before* memory is streamed in (the old code
+//    may be executing out of pages the loader is about to overwrite), so a
+//    diff-and-clear pass would need the load order below restructured around
+//    a bounce buffer plus per-page recClear, including the manual-protection
+//    interactions.
+// If load-time retranslation cost matters, that bounce-buffer diff is the
+// place to start, not code serialization.
 static void PreLoadPrep()
 {
 	SysClearExecutionCache();
@@ -172,6 +187,36 @@ static const uint MainMemorySizeInBytes =
 	Ps2MemSize::MainRam	+ Ps2MemSize::Scratch		+ Ps2MemSize::Hardware +
 	Ps2MemSize::IopRam	+ Ps2MemSize::IopHardware;
 
+// On an incremental per-page RAM hash stream for divergence detection: the
+// write-tracking half hits the same wall as delta states (next note) - the
+// vtlb fault machinery is owned by code protection, so "hash only dirty
+// pages" needs its own tracker. The workable shape is the worker variant:
+// snapshot-hash all of RAM at frame boundaries on a background thread
+// (xxh-class throughput makes 32MB a few ms of one core, pipelined behind
+// emulation), emit frame-stamped digests, and bisect divergence offline.
+// That needs no core hooks beyond a read-stable snapshot, i.e. the same
+// pause-or-COW decision documented for savestates; building it as an
+// external tool over the existing savestate stream avoids even that.
+//
+// On mmap-lazy state loading: faulting RAM in on first touch doesn't
+// compose with this runtime. The recompilers read guest memory at compile
+// time (block hashing, const propagation) and the manual-protection checks
+// compare source bytes on block entry, so "lazy" pages get touched almost
+// immediately and from code paths that must not take multi-ms faults; and
+// loads must still clear the caches and re-freeze devices first, which is
+// the bulk of DoLoadState wall time for warm page caches. (See also the
+// incremental-state note below; the two share the consistency problem.)
+//
+// On incremental/dirty-page states: the memory spans below are only part of
+// the state - a delta snapshot also has to be consistent with the register,
+// recompiler-visible and plugin (GS/SPU2) freezes taken in the same pause,
+// and the vtlb write protection that would track dirty pages is already
+// co-opted by the recompiler's code protection (manual/counted pages flip
+// protections at their own cadence), so "written since checkpoint" and
+// "write-protected right now" diverge immediately. A delta format is
+// feasible but owns its own tracking layer; it cannot ride the existing
+// fault machinery for free. (The same applies to rewind rings and
+// mmap-lazy loading built on such states.)
 SaveStateBase& SaveStateBase::FreezeMainMemory()
 {
 	vu1Thread.WaitVU(); // Finish VU1 just in-case...
@@ -301,6 +301,15 @@ static __fi void Sif0End()
 }
 
 // Transfer IOP to EE, putting data in the fifo as an intermediate step.
+// On speculative whole-packet SIF transfers: the ping-pong is protocol, not
+// overhead. SIF RPC is a conversation - the IOP side's sceSif dispatcher
+// reads each burst, runs the service handler, and the handler's reply
+// determines what the EE sends next - so "resolving the chain ahead of
+// time" would require knowing the IOP program's responses in advance.
+// Collapsing both completions to one timeline also breaks the explicit
+// EE/IOP cycle bookkeeping here (the counters below exist because titles
+// depend on SIF latency; see the DMA-tag notes in Hw.cpp for the same
+// conclusion from the chain-walker side).
 __fi void SIF0Dma()
 {
 	int BusyCheck = 0;
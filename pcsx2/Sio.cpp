@@ -35,6 +35,17 @@ _mcd *mcd;
 
 SIO_MODE siomode = SIO_START;
 static void sioWrite8inl(u8 data);
+
+// On moving host input polling off the EE thread: the host-API touch points
+// are in the PAD/USB backends, not here - SIO2 reads whatever state the pad
+// plugin returns, and the mainstream backends already sample asynchronously
+// (XInput keeps its own state cache, the Linux PAD backend pumps evdev from
+// its event loop) so a SIO2 command is a memory read of published state.
+// If a specific USB passthrough device still performs blocking host I/O
+// inside a command window, that's a bug in that backend's design and the
+// snapshot pattern belongs there; a global input thread in Sio.cpp would
+// add a handoff in front of backends that already have one.
+
 #define SIO_WRITE void inline
 #define SIO_FORCEINLINE __fi
 
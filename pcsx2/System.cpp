@@ -27,6 +27,10 @@
 #include "common/MemsetFast.inl"
 #include "common/Perf.h"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 
 // --------------------------------------------------------------------------------------
 //  RecompiledCodeReserve  (implementations)
@@ -416,6 +420,18 @@ void SysMainMemory::CommitAll()
 	m_ee.Commit();
 	m_iop.Commit();
 	m_vu.Commit();
+
+#ifdef __linux__
+	// Ask the kernel to back the hot guest memory with transparent huge
+	// pages. The recompiler's direct-access path hits the 32MB main RAM
+	// window constantly and 4K dTLB walks are measurable there; THP cuts
+	// the TLB footprint 512x where the kernel can satisfy it, and this is
+	// advisory only (no behavior change when it can't).
+	if (eeMem)
+		madvise(eeMem, sizeof(*eeMem), MADV_HUGEPAGE);
+	if (iopMem)
+		madvise(iopMem, sizeof(*iopMem), MADV_HUGEPAGE);
+#endif
 }
 
 
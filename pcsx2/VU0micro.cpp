@@ -34,6 +34,14 @@ void vu0ResetRegs()
 	vif0Regs.stat.VEW = false;
 }
 
+// On threading VU0 (MTVU-style): unlike VU1, VU0 can't be batched onto a
+// worker. Macro mode executes COP2 ops inline in the EE pipeline, and even
+// micro mode is driven by CTC2/QMTC2 register traffic with interlock
+// semantics - the EE legitimately reads VI/VF and VU0 memory a handful of
+// cycles after kicking a program, so nearly every execution would be an
+// immediate cross-thread sync. The "no interlock window" precondition the
+// idea needs is the rare case, not the common one, which is why only VU1
+// (fed through VIF1 packets with GS-directed output) gets a thread.
 void __fastcall vu0ExecMicro(u32 addr) {
 	VUM_LOG("vu0ExecMicro %x", addr);
 
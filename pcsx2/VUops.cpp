@@ -449,6 +449,15 @@ __fi void _vuBackupVI(VURegs* VU, u32 reg)
 /******************************/
 /*   VU Upper instructions    */
 /******************************/
+// On vectorizing the interpreter: the per-lane layout below is deliberate.
+// Each lane's arithmetic feeds VU_MACx_UPDATE, which derives sticky MAC and
+// status bits from the raw result (overflow/underflow/sign/zero per field),
+// and those helpers are the reference the accuracy comparisons are run
+// against. A whole-register SSE path would have to reproduce vuDouble's
+// denormal flush + INF clamp AND the flag derivation bit-exactly to stay a
+// valid reference - at which point it's a second implementation to validate,
+// not a faster one. Throughput work belongs in the recompilers; this file
+// optimizes for being obviously correct.
 #ifndef INT_VUDOUBLEHACK
 static float __fastcall vuDouble(u32 f)
 {
@@ -35,6 +35,25 @@ _vifT void vifTransferLoop(u32* &data) {
 	//VIF_LOG("Starting VIF%d loop, pSize = %x, stalled = %x", idx, pSize, vifX.vifstalled.enabled );
 	while (pSize > 0 && !vifX.vifstalled.enabled) {
 
+		// Fast path: command-dense streams (FMV/UI) pad with long NOP runs.
+		// A NOP with no i-bit only consumes a word; its other side effects
+		// (ExecQueue, the mskpath3-next timing break lookahead) are provided
+		// by the last NOP of the run, which still takes the normal handler.
+		if (!vifX.cmd && !vifX.irq && !vifXRegs.err.MII && pSize > 1
+		 && (data[0] >> 24) == 0 && (data[1] >> 24) == 0
+		 && !(IsDevBuild && SysTrace.EE.VIFcode.IsActive()))
+		{
+			u32 run = 1; // all but the last NOP of the run
+
+			while (run + 1 < pSize && (data[run + 1] >> 24) == 0)
+				run++;
+
+			vifXRegs.code = data[run - 1];
+			data  += run;
+			pSize -= run;
+			continue;
+		}
+
 		if(!vifX.cmd) { // Get new VifCode
 
 			if(!vifXRegs.err.MII)
@@ -551,6 +551,16 @@ void LoadAllPatchesAndStuff(const Pcsx2Config& cfg)
 #endif
 }
 
+// On a per-field config-diff engine: the no-op case is already free (the
+// fixup == EmuConfig early-out below), so what a classifier would save is
+// the pause+flush for fields that don't need one. The catch is that the
+// mapping from field to required action lives implicitly in every consumer
+// - recompilers latch Cpu/Speedhack options at block-compile time, the GS
+// thread snapshots its options at open, gamefix changes alter code the recs
+// have already emitted - so a safe classifier needs each consumer to declare
+// its dependencies, which is a Pcsx2Config redesign (per-group versioning),
+// not a diff utility here. Until then, conservative flushing is what keeps
+// settings changes from needing a correctness matrix per field.
 void AppCoreThread::ApplySettings(const Pcsx2Config& src)
 {
 	// Re-entry guard protects against cases where code wants to manually set core settings
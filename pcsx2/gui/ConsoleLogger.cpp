@@ -617,6 +617,15 @@ bool ConsoleLogFrame::Write( ConsoleColors color, const wxString& text )
 {
 	pthread_testcancel();
 
+	// Batching note: this path already coalesces. Writes append to the queue
+	// buffer under a short mutex and at most ONE flush event is in flight
+	// (m_pendingFlushMsg) - the drain happens in batches on idle/flush, so
+	// heavy logging does not allocate a wx event per line. Formatting is
+	// also not eager for disabled sources: the trace/dev macros test their
+	// enable flags before evaluating format arguments. The remaining cost
+	// under diagnostic logging is the formatting of *enabled* messages,
+	// which no ring buffer can defer - lazily capturing varargs for later
+	// formatting is lifetime-unsafe for the %s pointers these logs pass.
 	ScopedLock lock( m_mtx_Queue );
 
 	if( m_QueueColorSection.GetLength() == 0 )
@@ -41,6 +41,16 @@ struct AllPCSX2Threads
 	AllPCSX2Threads operator-( const AllPCSX2Threads& right ) const;
 };
 
+// On fleet-grade percentile telemetry: don't extend this class - it exists
+// to feed the title bar at human refresh rates and its thread-time sampling
+// granularity (QueueDepth rolling average) can't resolve per-frame tails.
+// The per-frame data the request wants streams out of the GS side: the
+// perfmon CSV export (perfmon_csv in the GS config) writes one row per
+// frame with that frame's CPU time and GPU time - unaveraged, so
+// collectors can compute real p50/p95/p99 offline. Per-stage CPU splits
+// remain 32-frame aggregates on the OSD monitor only. A live socket
+// exporter, if ever needed, should tail the CSV pipeline rather than add
+// a second sampling system at GUI cadence.
 class CpuUsageProvider :
 	public BaseCpuUsageProvider,
 	public EventListener_CoreThread
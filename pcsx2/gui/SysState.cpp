@@ -44,6 +44,34 @@
 // is then mailed to another thread for zip archiving, while the main emulation process is
 // allowed to continue execution.
 //
+// On a content-addressed (dedup) archive backend: sensible for a state farm,
+// but it's a storage format, not an emulator concern - the write side here
+// hands ArchiveEntryList buffers to a zip stream, and a chunk-hash-store
+// backend would bake a bespoke container into the emulator that every other
+// consumer of .p2s files then has to speak. The farm-side answer is to run
+// dedup where the farm already is: store states uncompressed-chunked and let
+// a content-addressed filesystem/object store (or a post-process pass over
+// the existing zip entries, which are already per-region) do block dedup.
+//
+// On COW-snapshot capture (fork on Linux / VirtualProtect on Windows) to
+// make even the freeze pause vanish: the guest image isn't one mapping -
+// it's the SysMainMemory reserves plus GS/SPU2/VU plugin state that only
+// exists as Freeze() callbacks, so a page-level frozen view captures the
+// RAM but not a consistent device state; the devices still have to be
+// paused and frozen explicitly, which is the pause we already take. fork()
+// additionally drags every emulation thread's locks across the fork
+// boundary (MTGS/MTVU hold theirs at arbitrary points). The honest framing:
+// the current pause IS the device-consistency point, and it's short.
+//
+// Perf note for anyone chasing save-time stalls: compression is therefore
+// already off the core thread; the core only pays for the freeze itself (a
+// structured copy of guest state into the buffer). Parallel/zstd compression
+// of the archive step would shrink SysExecutor wall time, not the visible
+// hitch - and zstd isn't vendored in this tree anyway. To shrink the hitch,
+// attack the freeze copy (the FreezeMem spans dominate), e.g. wide copies;
+// a fork/COW snapshot is the real fix but needs every guest-memory owner
+// (GS, SPU2, VU threads) quiesced at one point, which pausing already does.
+//
 class SysExecEvent_DownloadState : public SysExecEvent
 {
 protected:
@@ -197,6 +197,15 @@ typedef std::list<SysExecEvent*> pxEvtList;
 //    use for anything other than wxWindow events (it uses static vars and checks/modifies
 //    wxApp globals while processing), so it's useless to us.  Have to roll our own. -_-
 //
+// On converting core-to-GUI traffic to fire-and-forget: most of it already
+// is - PostEvent is asynchronous and the emulation threads don't wait on it.
+// The synchronous residue (modal confirmations via MsgboxEventResult, the
+// settings-save round trip) is synchronous because the core genuinely
+// cannot proceed without the answer: a blocking BIOS-missing dialog or an
+// are-you-sure prompt gates the next emulation step. A lock-free snapshot
+// can't answer a question the user hasn't been asked yet. Anything that
+// doesn't gate progress should simply use PostEvent, and new code should -
+// that's a review rule, not a framework change.
 class pxEvtQueue
 {
 protected:
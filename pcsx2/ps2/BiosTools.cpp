@@ -253,6 +253,16 @@ static void LoadIrx( const std::string& filename, u8* dest )
 // Exceptions:
 //   BadStream - Thrown if the primary bios file (usually .bin) is not found, corrupted, etc.
 //
+// On sharing ROM pages across instances via a read-only mapping: the ROM
+// region isn't read-only at runtime here. The BIOS lands inside eeMem->ROM
+// within the contiguous HostMemoryMap reserve (fixed offsets relative to
+// the other guest regions, which the recompilers bake into generated code),
+// patches and the IRX/BOOT2 injection hacks write into it, and savestate
+// loads overwrite it - so per-instance private pages are the semantics, and
+// carving a MAP_SHARED file mapping into the middle of the reserve would
+// fight the VirtualMemoryManager's ownership of that range. Fleet-side,
+// the kernel's page cache already shares the *file* read cost; what's
+// duplicated is 4MB of private pages per instance after first write.
 void LoadBIOS()
 {
 	pxAssertDev( eeMem->ROM != NULL, "PS2 system memory has not been initialized yet." );
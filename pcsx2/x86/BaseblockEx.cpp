@@ -79,4 +79,5 @@ void BaseBlocks::Link(u32 pc, s32* jumpptr)
 	else
 		*jumpptr = (s32)(recompiler - (sptr)(jumpptr + 1));
 	links.insert(std::pair<u32, uptr>(pc, (uptr)jumpptr));
+	links_by_source[(uptr)jumpptr] = pc;
 }
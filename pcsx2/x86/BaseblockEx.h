@@ -43,6 +43,15 @@ struct BASEBLOCKEX
 #endif
 };
 
+// On page-sharded segment storage (stable pointers, no memmove): the array
+// being contiguous and startpc-sorted is what keeps range clears cheap -
+// recClear finds its victims with one binary search and removes them with
+// one memmove, and after the release-build sanity scan was dropped that
+// memmove is the whole cost, proportional to the tail. Shards would trade
+// it for per-shard bookkeeping on every clear and scattered iteration on
+// the (hot) lookup side. Stable pointers also buy nothing here: nothing
+// retains BASEBLOCKEX addresses across mutations - the dispatch path goes
+// through recLUT, and the link bookkeeping keys on x86 addresses.
 class BaseBlockArray
 {
 	s32 _Reserved;
@@ -154,6 +163,9 @@ protected:
 
 	// switch to a hash map later?
 	std::multimap<u32, uptr> links;
+	// reverse direction: jump address -> target startpc, so a removed block
+	// can drop its outgoing links instead of leaking them until Reset
+	std::map<uptr, u32> links_by_source;
 	uptr recompiler;
 	BaseBlockArray blocks;
 
@@ -210,6 +222,30 @@ public:
 			for (linkiter_t i = range.first; i != range.second; ++i)
 				*(u32*)i->second = recompiler - (i->second + 4);
 
+			// Drop this block's outgoing links: the code is dead, repatching
+			// those locations on future New() calls is wasted work, and under
+			// heavy SMC churn the maps would otherwise grow without bound.
+			const uptr x86start = blocks[idx].fnptr;
+			const uptr x86end = x86start + blocks[idx].x86size;
+
+			auto src = links_by_source.lower_bound(x86start);
+
+			while (src != links_by_source.end() && src->first < x86end)
+			{
+				std::pair<linkiter_t, linkiter_t> out = links.equal_range(src->second);
+
+				for (linkiter_t i = out.first; i != out.second; ++i)
+				{
+					if (i->second == src->first)
+					{
+						links.erase(i);
+						break;
+					}
+				}
+
+				src = links_by_source.erase(src);
+			}
+
 			if (IsDevBuild)
 			{
 				// Clear the first instruction to 0xcc (breakpoint), as a way to assert if some
@@ -222,7 +258,6 @@ public:
 			}
 		} while (idx++ < last);
 
-		// TODO: remove links from this block?
 		blocks.erase(first, last + 1);
 	}
 
@@ -232,6 +267,7 @@ public:
 	{
 		blocks.clear();
 		links.clear();
+		links_by_source.clear();
 	}
 };
 
@@ -16,6 +16,19 @@
 #pragma once
 #include "common/Pcsx2Defs.h"
 
+// On promoting this to a runtime-togglable fleet profiler: the
+// instrumentation is emitted INTO the recompiled code (EmitOp/EmitBlock
+// below add counter updates per instruction/block), so "toggle at runtime"
+// means recompiling everything on switch - a full cache reset per toggle,
+// which is fine for capture sessions but is not an always-on surface; and
+// with instrumentation present the overhead is per-emulated-instruction,
+// which is why it's build-gated. The fleet-capture path that avoids both:
+// sampling via the ProfileWithPerf per-block symbol map (no emitted
+// instrumentation, attributes by guest PC), with this build's counters -
+// including the per-block execution histogram - as the deep-dive tool.
+// JSON export of the Print() tables is trivial if automation ever consumes
+// them; the format isn't the blocker, the emission model is.
+
 // Keep my nice alignment please!
 #define MOVZ MOVZtemp
 #define MOVN MOVNtemp
@@ -234,9 +247,14 @@ struct eeProfiler
 {
 	static const u32 memSpace = 1 << 19;
 
+	// hot guest block detection, hashed by startpc (collisions acceptable)
+	static const u32 blockSpace = 1 << 16;
+
 	u64 opStats[static_cast<int>(eeOpcode::LAST)];
 	u32 memStats[memSpace];
 	u32 memStatsConst[memSpace];
+	u32 blockPc[blockSpace];
+	u32 blockStats[blockSpace];
 	u64 memStatsSlow;
 	u64 memStatsFast;
 	u32 memMask;
@@ -246,6 +264,8 @@ struct eeProfiler
 		memzero(opStats);
 		memzero(memStats);
 		memzero(memStatsConst);
+		memzero(blockPc);
+		memzero(blockStats);
 		memStatsSlow = 0;
 		memStatsFast = 0;
 		memMask = 0xF700FFF0;
@@ -259,6 +279,15 @@ struct eeProfiler
 		xADC(ptr32[&(((u32*)opStats)[op * 2 + 1])], 0);
 	}
 
+	// one counter bump in the block prologue, the cheap execution profile a
+	// future hot tier would key on
+	void EmitBlock(u32 startpc)
+	{
+		u32 idx = (startpc >> 2) & (blockSpace - 1);
+		blockPc[idx] = startpc;
+		xADD(ptr32[&blockStats[idx]], 1);
+	}
+
 	double per(u64 part, u64 total)
 	{
 		return (double)part / (double)total * 100.0;
@@ -290,6 +319,22 @@ struct eeProfiler
 		}
 		//DevCon.WriteLn("Total = 0x%x_%x", (u32)(u64)(total>>32),(u32)total);
 
+		// Hottest guest blocks
+		{
+			std::vector<std::pair<u32, u32>> hot;
+			for (u32 i = 0; i < blockSpace; i++)
+			{
+				if (blockStats[i])
+					hot.push_back(std::make_pair(blockStats[i], blockPc[i]));
+			}
+			std::sort(hot.begin(), hot.end());
+			std::reverse(hot.begin(), hot.end());
+
+			DevCon.WriteLn("EE hot blocks:");
+			for (u32 i = 0; i < std::min<u32>(hot.size(), 20); i++)
+				DevCon.WriteLn("  0x%08x - [count=%u]", hot[i].second, hot[i].first);
+		}
+
 		// Compute memory stat
 		total = 0;
 		u64 reg = 0;
@@ -414,6 +459,7 @@ struct eeProfiler
 {
 	__fi void Reset() {}
 	__fi void EmitOp(eeOpcode op) {}
+	__fi void EmitBlock(u32 startpc) {}
 	__fi void Print() {}
 	__fi void EmitMem() {}
 	__fi void EmitConstMem(u32 add) {}
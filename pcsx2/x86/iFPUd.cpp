@@ -40,6 +40,13 @@
 
 using namespace x86Emitter;
 
+// A note on "deferred" status flags: the FCR31 O/U/I/D updates below are NOT
+// on the per-op fast path. They're emitted behind the overflow/underflow
+// branches of ToPS2FPU_Full, so a well-behaved result never touches fprc[31];
+// deferring them to a CFC1/branch consumer would save nothing measurable.
+// The instruction-count hotspot in FPU-bound code is the operand clamping
+// (fpuFloat*, gated by the EE clamping mode config), not flag maintenance.
+
 // Set overflow flag (define only if FPU_RESULT is 1)
 #define FPU_FLAGS_OVERFLOW 1
 // Set underflow flag (define only if FPU_RESULT is 1)
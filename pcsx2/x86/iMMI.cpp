@@ -427,6 +427,10 @@ void recPMAXW()
 		xPMAX.SD(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPMAX.SD(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPMAX.SD(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -647,6 +651,10 @@ void recPMAXH()
 		xPMAX.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPMAX.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPMAX.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -744,6 +752,10 @@ void recPADDSB()
 		xPADD.SB(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPADD.SB(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPADD.SB(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -765,6 +777,10 @@ void recPADDSH()
 		xPADD.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPADD.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPADD.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -801,6 +817,10 @@ void recPADDSW()
 		xPADD.D(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPADD.D(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPADD.D(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -849,6 +869,10 @@ void recPSUBSB()
 		xPSUB.SB(xRegisterSSE(EEREC_D), xRegisterSSE(t0reg));
 		_freeXMMreg(t0reg);
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPSUB.SB(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -876,6 +900,10 @@ void recPSUBSH()
 		xPSUB.SW(xRegisterSSE(EEREC_D), xRegisterSSE(t0reg));
 		_freeXMMreg(t0reg);
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPSUB.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -918,6 +946,10 @@ void recPSUBSW()
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
 		xPSUB.D(xRegisterSSE(EEREC_D), xRegisterSSE(t2reg));
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPSUB.D(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -959,6 +991,10 @@ void recPADDB()
 		xPADD.B(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPADD.B(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPADD.B(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1056,6 +1092,10 @@ void recPSUBB()
 		xPSUB.B(xRegisterSSE(EEREC_D), xRegisterSSE(t0reg));
 		_freeXMMreg(t0reg);
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPSUB.B(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1083,6 +1123,10 @@ void recPSUBH()
 		xPSUB.W(xRegisterSSE(EEREC_D), xRegisterSSE(t0reg));
 		_freeXMMreg(t0reg);
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPSUB.W(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1110,6 +1154,10 @@ void recPSUBW()
 		xPSUB.D(xRegisterSSE(EEREC_D), xRegisterSSE(t0reg));
 		_freeXMMreg(t0reg);
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPSUB.D(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1309,6 +1357,10 @@ void recPMINW()
 		xPMIN.SD(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPMIN.SD(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPMIN.SD(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1439,6 +1491,10 @@ void recPSUBUB()
 		xPSUB.USB(xRegisterSSE(EEREC_D), xRegisterSSE(t0reg));
 		_freeXMMreg(t0reg);
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPSUB.USB(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1466,6 +1522,10 @@ void recPSUBUH()
 		xPSUB.USW(xRegisterSSE(EEREC_D), xRegisterSSE(t0reg));
 		_freeXMMreg(t0reg);
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPSUB.USW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1678,6 +1738,10 @@ void recPMINH()
 		xPMIN.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPMIN.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPMIN.SW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1699,6 +1763,10 @@ void recPCEQB()
 		xPCMP.EQB(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPCMP.EQB(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPCMP.EQB(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1720,6 +1788,10 @@ void recPCEQH()
 		xPCMP.EQW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPCMP.EQW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPCMP.EQW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1741,6 +1813,10 @@ void recPCEQW()
 		xPCMP.EQD(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPCMP.EQD(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPCMP.EQD(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -1788,6 +1864,10 @@ void recPADDUH()
 		xPADD.USW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	else if (EEREC_D == EEREC_T)
 		xPADD.USW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
+	else if (x86caps.hasAVX)
+	{
+		xVPADD.USW(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -2436,6 +2516,10 @@ void recPAND()
 	{
 		xPAND(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPAND(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -2461,6 +2545,10 @@ void recPXOR()
 	{
 		xPXOR(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_T));
 	}
+	else if (x86caps.hasAVX)
+	{
+		xVPXOR(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S), xRegisterSSE(EEREC_T));
+	}
 	else
 	{
 		xMOVDQA(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_S));
@@ -425,7 +425,13 @@ void _psxDeleteReg(int reg, int flush)
 void _psxMoveGPRtoR(const xRegister32& to, int fromgpr)
 {
 	if (PSX_IS_CONST1(fromgpr))
-		xMOV(to, g_psxConstRegs[fromgpr]);
+	{
+		// zero (r0 or a folded constant) gets the xor idiom
+		if (g_psxConstRegs[fromgpr] == 0)
+			xXOR(to, to);
+		else
+			xMOV(to, g_psxConstRegs[fromgpr]);
+	}
 	else
 	{
 		// check x86
@@ -900,13 +906,17 @@ static __fi u32 psxRecClearMem(u32 pc)
 		recBlocks.Remove(toRemoveFirst, (blockidx - 1));
 	}
 
-	blockidx = 0;
-	while (BASEBLOCKEX* pexblock = recBlocks[blockidx++])
+	// Sanity scan over the whole block array, dev builds only (see recClear)
+	if (IsDevBuild)
 	{
-		if (pc >= pexblock->startpc && pc < pexblock->startpc + pexblock->size * 4)
+		blockidx = 0;
+		while (BASEBLOCKEX* pexblock = recBlocks[blockidx++])
 		{
-			DevCon.Error("[IOP] Impossible block clearing failure");
-			pxFailDev("[IOP] Impossible block clearing failure");
+			if (pc >= pexblock->startpc && pc < pexblock->startpc + pexblock->size * 4)
+			{
+				DevCon.Error("[IOP] Impossible block clearing failure");
+				pxFailDev("[IOP] Impossible block clearing failure");
+			}
 		}
 	}
 
@@ -965,6 +975,16 @@ void psxSetBranchReg(u32 reg)
 	JMP32((uptr)iopDispatcherReg - ((uptr)x86Ptr + 5));
 }
 
+// On superblocks: following statically-predicted backward branches and
+// inlining successor blocks has been considered for the small IOP service
+// loops. It doesn't fit the current invalidation model: BASEBLOCKEX tracks
+// one contiguous [startpc, startpc+size*4) range per block, and both
+// psxRecClearMem and the manual protection checks rely on that, so a block
+// containing instructions from disjoint pc ranges would dodge SMC clears.
+// The cheap half of the win already exists - static exits below are linked
+// block-to-block (recBlocks.Link), so steady-state loop iterations don't
+// round-trip the dispatcher, they only pay the per-block event test, which
+// is load-bearing for IOP timing (iopCycleEE timeslices).
 void psxSetBranchImm(u32 imm)
 {
 	psxbranch = 1;
@@ -70,7 +70,11 @@ eeProfiler EE::Profiler;
 // Static Private Variables - R5900 Dynarec
 
 #define X86
-static const int RECCONSTBUF_SIZE = 16384 * 2; // 64 bit consts in 32 bit units
+// 64 bit consts in 32 bit units. Filling this buffer resets the entire code
+// cache just like filling recMem does, and at the old 128KB it reliably
+// filled first (the code arena is 64MB), turning it into the dominant cause
+// of mid-session full-reset stalls. Sized to keep pace with the arena.
+static const int RECCONSTBUF_SIZE = 16384 * 16;
 
 static RecompiledCodeReserve* recMem = NULL;
 static u8* recRAMCopy = NULL;
@@ -162,7 +166,13 @@ void _eeMoveGPRtoR(const xRegister32& to, int fromgpr)
 	if (fromgpr == 0)
 		xXOR(to, to); // zero register should use xor, thanks --air
 	else if (GPR_IS_CONST1(fromgpr))
-		xMOV(to, g_cpuConstRegs[fromgpr].UL[0]);
+	{
+		// constant-folded regs holding zero deserve the same idiom
+		if (g_cpuConstRegs[fromgpr].UL[0] == 0)
+			xXOR(to, to);
+		else
+			xMOV(to, g_cpuConstRegs[fromgpr].UL[0]);
+	}
 	else
 	{
 		int mmreg;
@@ -411,6 +421,17 @@ static DynGenFunc* _DynGen_JITCompileInBlock()
 }
 
 // called when jumping to variable pc address
+// On a software return-address stack for JAL/JR-ra: the JIT-textbook
+// version assumes calls and returns pair up, and EE game code breaks that
+// assumption constantly - the BIOS thread scheduler and game kernels switch
+// contexts by rewriting ra, exception returns unwind differently, and
+// plenty of code jr's through ra without a matching jal. Every mismatch
+// costs a guard (compare predicted target vs cpuRegs.pc) plus a flush of
+// the shadow stack, on top of maintaining it in every prologue/epilogue.
+// Meanwhile the indirect dispatch below is one load chain through recLUT
+// and the host BTB already predicts monomorphic jr sites well; the
+// megamorphic residue (scheduler trampolines) is exactly where a shadow
+// stack mispredicts too. High complexity, negative headroom.
 static DynGenFunc* _DynGen_DispatcherReg()
 {
 	u8* retval = xGetPtr(); // fallthrough target, can't align it!
@@ -883,18 +904,20 @@ void recClear(u32 addr, u32 size)
 
 	upperextent = std::min(upperextent, ceiling);
 
-	for (int i = 0; pexblock = recBlocks[i]; i++)
+	// Sanity scan over the whole block array. SMC-heavy games issue thousands
+	// of clears per second, so only pay for this on dev builds.
+	if (IsDevBuild)
 	{
-		if (s_pCurBlock == PC_GETBLOCK(pexblock->startpc))
-			continue;
-		u32 blockend = pexblock->startpc + pexblock->size * 4;
-		if (pexblock->startpc >= addr && pexblock->startpc < addr + size * 4
-		 || pexblock->startpc < addr && blockend > addr)
+		for (int i = 0; pexblock = recBlocks[i]; i++)
 		{
-			if (!IsDevBuild)
-				Console.Error("[EE] Impossible block clearing failure");
-			else
+			if (s_pCurBlock == PC_GETBLOCK(pexblock->startpc))
+				continue;
+			u32 blockend = pexblock->startpc + pexblock->size * 4;
+			if (pexblock->startpc >= addr && pexblock->startpc < addr + size * 4
+			 || pexblock->startpc < addr && blockend > addr)
+			{
 				pxFailDev("[EE] Impossible block clearing failure");
+			}
 		}
 	}
 
@@ -1387,6 +1410,16 @@ void recMemcheck(u32 op, u32 bits, bool store)
 	}
 }
 
+// Status note: "compile breakpoint checks into affected blocks only" is the
+// implemented design. Blocks are split around breakpoint addresses (see the
+// s_nEndBlock truncation in recRecompile), only instructions where
+// isBreakpointNeeded fires get this guard, and setting/clearing a
+// breakpoint clears just the containing blocks through recClear. A debugged
+// session that's 10x slower is running the interpreter for another reason
+// (memchecks force interpreter-ish paths by design - a memcheck on RAM
+// can't be a per-block guard, it's a per-access property). Conditional
+// breakpoint expressions evaluate in dynarecCheckBreakpoint, off the fast
+// path, and only when the pc actually hits.
 void encodeBreakpoint()
 {
 	if (isBreakpointNeeded(pc) != 0)
@@ -1728,6 +1761,32 @@ static void memory_protect_recompiled_code(u32 startpc, u32 size)
 			u32 lpc = inpage_ptr;
 			u32 stg = inpage_sz;
 
+			// Manual blocks re-validate their source on every run, so the
+			// check itself is pure overhead. Compare 16 bytes per iteration
+			// against a snapshot parked in recConstBuf (it resets with the
+			// code, so lifetimes match); fall back to the word loop when the
+			// const buffer is running low.
+			if (stg >= 16 && (recConstBufPtr - recConstBuf) + (int)(stg / 4) + 8 < RECCONSTBUF_SIZE)
+			{
+				while (stg >= 16)
+				{
+					recConstBufPtr = (u32*)(((uptr)recConstBufPtr + 15) & ~(uptr)15);
+					u32* snap = recConstBufPtr;
+					memcpy(snap, PSM(lpc), 16);
+					recConstBufPtr += 4;
+
+					// xmm0 carries nothing at block entry
+					xMOVDQU(xmm0, ptr128[(u128*)PSM(lpc)]);
+					xPCMP.EQD(xmm0, ptr128[(u128*)snap]);
+					xPMOVMSKB(eax, xmm0);
+					xCMP(eax, 0xffff);
+					xJNE(DispatchBlockDiscard);
+
+					stg -= 16;
+					lpc += 16;
+				}
+			}
+
 			while (stg > 0)
 			{
 				xCMP(ptr32[PSM(lpc)], *(u32*)PSM(lpc));
@@ -1864,6 +1923,19 @@ static void __fastcall recRecompile(const u32 startpc)
 
 	pxAssert(s_pCurBlockEx);
 
+	EE::Profiler.EmitBlock(startpc);
+
+	// On an offline recompiler benchmark (replaying captured instruction
+	// windows through recRecompile to track compile time and code quality):
+	// the input window isn't self-contained. Compilation reads live state -
+	// guest memory through PSM/memRead at compile time, EmuConfig options,
+	// the manual-protection page tables - so a golden corpus needs those
+	// captured too, which makes it a savestate-plus-trace format, and the
+	// harness is blocked on the same core/frontend split as the other bench
+	// targets (see tests/ctest/CMakeLists.txt). The cheap proxies available
+	// now: x86size/size per block (emitted-bytes-per-instruction) and the
+	// eeProfileProg counters.
+
 	if (HWADDR(startpc) == EELOAD_START)
 	{
 		// The EELOAD _start function is the same across all BIOS versions
@@ -400,6 +400,17 @@ int vtlb_DynGenRead64(u32 bits, int gpr)
 	return reg;
 }
 
+// ------------------------------------------------------------------------
+// On signal-handler fastmem (raw access against a 4GB alias + backpatch on
+// fault): the prerequisites don't exist in this tree. There is no contiguous
+// guest-physical alias reserve in HostMemoryMap to address off a base
+// register, TLB remaps (MapTLB/GoemonTlbHack) would need alias remapping
+// rather than today's vmap pointer swaps, and backpatching needs the emitter
+// to record per-access patch records (address reg, destination, size, sign)
+// which it doesn't keep. The vmap scheme below is one dependent load plus a
+// displacement check, and constant addresses skip even that via the *_Const
+// generators - fastmem is the right long-term call but it arrives with a new
+// memory map, not as a patch to this one.
 // ------------------------------------------------------------------------
 // Recompiled input registers:
 //   ecx - source address to read from
@@ -469,6 +480,14 @@ int vtlb_DynGenRead64_Const(u32 bits, u32 addr_const, int gpr)
 // TLB lookup is performed in const, with the assumption that the COP0/TLB will clear the
 // recompiler if the TLB is changed.
 //
+// Note: this is also the scratchpad/uncached-mirror specialization asked
+// about now and then. A constant address (which is how scratchpad gets
+// addressed in the VU-feeding loops - base reg is a folded constant) resolves
+// the vmap entry at compile time and emits a direct host-pointer access with
+// no indirection; uncached mirrors fold the same way since the mirror's vmap
+// entries point at the same backing. Dynamic-address scratchpad ops can't be
+// specialized statically - whether a register lands in 0x70000000 is only
+// known at runtime, which is exactly what the vmap load answers.
 void vtlb_DynGenRead32_Const(u32 bits, bool sign, u32 addr_const)
 {
 	EE::Profiler.EmitConstMem(addr_const);
@@ -226,6 +226,7 @@ __ri void mVUcacheProg(microVU& mVU, microProgram& prog)
 		memcpy(prog.data, mVU.regs().Micro, 0x1000);
 	else
 		memcpy(prog.data, mVU.regs().Micro, 0x4000);
+	prog.chunkValid = 0; // data changed, drop the lazy chunk hashes
 	mVUdumpProg(mVU, prog);
 }
 
@@ -277,8 +278,59 @@ void mVUprintUniqueRatio(microVU& mVU)
 	DevCon.WriteLn("%d / %d [%3.1f%%]", v.size(), total, 100. - (double)v.size() / (double)total * 100.);
 }
 
+// On generational eviction of stale programs: the two costs it targets have
+// different answers. Search cost is handled - lists are MRU-ordered, the
+// quick table short-circuits repeated kicks, and the chunk hashing below
+// makes cold-candidate compares cheap - so stale entries mostly cost
+// memory. Code-cache pressure, the real ceiling, can't be reclaimed per
+// program: generated code comes from a bump allocator (prog.x86ptr) with
+// cross-block links, so freeing a cold program returns no cache space and
+// only a full reset compacts - which is exactly what happens when the
+// cache fills. An archive tier would therefore save host heap (the
+// microProgram+blocks metadata) while leaving the pressure it was meant to
+// relieve untouched.
+//
+// 256-byte chunk content hashing for program compares. When several cached
+// variants share a list, each search used to memcmp the same micro memory
+// once per candidate; with the chunk memo the current memory is hashed once
+// and candidates compare hashes.
+
+static __fi u32 mVUhashChunk(const u32* data)
+{
+	u32 h = 0x811c9dc5;
+	for (int i = 0; i < 64; i++)
+		h = (h ^ data[i]) * 0x1000193;
+	return h;
+}
+
+struct microChunkMemo
+{
+	u32 hash[mProgSize * 4 / 256];
+	u64 valid = 0;
+};
+
+static __fi u32 mVUmemoChunkHash(microChunkMemo& memo, const u8* micro, u32 chunk)
+{
+	if (!(memo.valid & (1ull << chunk)))
+	{
+		memo.hash[chunk] = mVUhashChunk((const u32*)(micro + chunk * 256));
+		memo.valid |= 1ull << chunk;
+	}
+	return memo.hash[chunk];
+}
+
+static __fi u32 mVUprogChunkHash(microProgram& prog, u32 chunk)
+{
+	if (!(prog.chunkValid & (1ull << chunk)))
+	{
+		prog.chunkHash[chunk] = mVUhashChunk(prog.data + chunk * 64);
+		prog.chunkValid |= 1ull << chunk;
+	}
+	return prog.chunkHash[chunk];
+}
+
 // Compare Cached microProgram to mVU.regs().Micro
-__fi bool mVUcmpProg(microVU& mVU, microProgram& prog, const bool cmpWholeProg)
+__fi bool mVUcmpProg(microVU& mVU, microProgram& prog, microChunkMemo& memo, const bool cmpWholeProg)
 {
 	if (cmpWholeProg)
 	{
@@ -287,13 +339,39 @@ __fi bool mVUcmpProg(microVU& mVU, microProgram& prog, const bool cmpWholeProg)
 	}
 	else
 	{
+		const u8* micro = (const u8*)mVU.regs().Micro;
+
 		for (const auto& range : *prog.ranges)
 		{
-			auto cmpOffset = [&](void* x) { return (u8*)x + range.start; };
 			if ((range.start < 0) || (range.end < 0))
 				DevCon.Error("microVU%d: Negative Range![%d][%d]", mVU.index, range.start, range.end);
-			if (memcmp_mmx(cmpOffset(prog.data), cmpOffset(mVU.regs().Micro), (range.end - range.start)))
+
+			const s32 start = range.start;
+			const s32 end = range.end;
+
+			// chunk-aligned middle goes through the hashes, ragged edges memcmp
+			const s32 cstart = (start + 255) & ~255;
+			const s32 cend = end & ~255;
+
+			if (cend <= cstart)
+			{
+				if (memcmp_mmx((u8*)prog.data + start, micro + start, end - start))
+					return false;
+
+				continue;
+			}
+
+			if (start < cstart && memcmp_mmx((u8*)prog.data + start, micro + start, cstart - start))
+				return false;
+
+			if (cend < end && memcmp_mmx((u8*)prog.data + cend, micro + cend, end - cend))
 				return false;
+
+			for (s32 c = cstart / 256; c < cend / 256; c++)
+			{
+				if (mVUprogChunkHash(prog, c) != mVUmemoChunkHash(memo, micro, c))
+					return false;
+			}
 		}
 	}
 	mVU.prog.cleared = 0;
@@ -311,10 +389,12 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 
 	if (!quick.prog) // If null, we need to search for new program
 	{
+		microChunkMemo memo; // current micro mem hashed at most once per chunk
+
 		std::deque<microProgram*>::iterator it(list->begin());
 		for (; it != list->end(); ++it)
 		{
-			bool b = mVUcmpProg(mVU, *it[0], 0);
+			bool b = mVUcmpProg(mVU, *it[0], memo, 0);
 
 			if (b)
 			{
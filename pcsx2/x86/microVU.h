@@ -48,6 +48,7 @@ class microBlockManager
 private:
 	microBlockLink *qBlockList, *qBlockEnd; // Quick Search
 	microBlockLink *fBlockList, *fBlockEnd; // Full  Search
+	microBlock* lastSearch; // monomorphic cache, repeated states dominate
 	int qListI, fListI;
 
 public:
@@ -57,6 +58,7 @@ public:
 		qListI = fListI = 0;
 		qBlockEnd = qBlockList = NULL;
 		fBlockEnd = fBlockList = NULL;
+		lastSearch = NULL;
 	}
 	~microBlockManager() { reset(); }
 	void reset()
@@ -78,6 +80,7 @@ public:
 		qListI = fListI = 0;
 		qBlockEnd = qBlockList = NULL;
 		fBlockEnd = fBlockList = NULL;
+		lastSearch = NULL;
 	};
 	microBlock* add(microBlock* pBlock)
 	{
@@ -109,16 +112,36 @@ public:
 			memcpy(&newBlock->block, pBlock, sizeof(microBlock));
 			thisBlock = &newBlock->block;
 		}
+		lastSearch = thisBlock;
 		return thisBlock;
 	}
 	__ri microBlock* search(microRegInfo* pState)
 	{
+		// check the last hit before walking the lists, repeated kicks at the
+		// same pipeline state are the common case
+		if (lastSearch)
+		{
+			if (pState->needExactMatch)
+			{
+				if (lastSearch->pState.needExactMatch
+				 && mVUquickSearch((void*)pState, (void*)&lastSearch->pState, sizeof(microRegInfo)))
+					return lastSearch;
+			}
+			else if (!lastSearch->pState.needExactMatch
+				  && (lastSearch->pState.quick32[0] == pState->quick32[0])
+				  && (lastSearch->pState.quick32[1] == pState->quick32[1])
+				  && (!doConstProp || ((lastSearch->pState.vi15 == pState->vi15)
+				                    && (lastSearch->pState.vi15v == pState->vi15v))))
+			{
+				return lastSearch;
+			}
+		}
 		if (pState->needExactMatch) // Needs Detailed Search (Exact Match of Pipeline State)
 		{
 			for (microBlockLink* linkI = fBlockList; linkI != NULL; linkI = linkI->next)
 			{
 				if (mVUquickSearch((void*)pState, (void*)&linkI->block.pState, sizeof(microRegInfo)))
-					return &linkI->block;
+					return lastSearch = &linkI->block;
 			}
 		}
 		else // Can do Simple Search (Only Matches the Important Pipeline Stuff)
@@ -129,7 +152,7 @@ public:
 				if (linkI->block.pState.quick32[1] != pState->quick32[1]) continue;
 				if (doConstProp && (linkI->block.pState.vi15  != pState->vi15))  continue;
 				if (doConstProp && (linkI->block.pState.vi15v != pState->vi15v)) continue;
-				return &linkI->block;
+				return lastSearch = &linkI->block;
 			}
 		}
 		return NULL;
@@ -170,6 +193,8 @@ struct microProgram
 	u32                data [mProgSize];     // Holds a copy of the VU microProgram
 	microBlockManager* block[mProgSize / 2]; // Array of Block Managers
 	std::deque<microRange>* ranges;          // The ranges of the microProgram that have already been recompiled
+	u32 chunkHash[mProgSize * 4 / 256]; // lazily computed per-256-byte hashes of data
+	u64 chunkValid;                     // validity bitmap for chunkHash
 	u32 startPC; // Start PC of this program
 	int idx;     // Program index
 };
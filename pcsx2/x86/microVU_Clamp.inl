@@ -28,6 +28,16 @@ const __aligned16 u32 sse4_maxvals[2][4] = {
 	{0x7f7fffff, 0x7f7fffff, 0x7f7fffff, 0x7f7fffff}, //1111
 };
 
+// On a clamped-ness dataflow pass to elide redundant clamps: the catch is
+// that "clamped" isn't a stable property of a VF register. A value clamped
+// after one op stops being provably in-range the moment it's an operand to
+// any arithmetic (the op can overflow again), so the only elidable clamps
+// are back-to-back clamp pairs on an untouched register - which the
+// emitters don't generate - and move chains, which don't clamp anyway. The
+// per-game clamp requirements the request wants to learn already have a
+// home: the GameDB sets vuClampMode per title, which is the level at which
+// clamping is safely negotiable.
+//
 // Used for Result Clamping
 // Note: This function will not preserve NaN values' sign.
 // The theory behind this is that when we compute a result, and we've
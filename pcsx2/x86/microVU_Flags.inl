@@ -116,6 +116,16 @@ void sortFullFlag(int* fFlag, int* bFlag)
 #define sHackCond (mVUsFlagHack && !sFLAG.doNonSticky)
 
 // Note: Flag handling is 'very' complex, it requires full knowledge of how microVU recs work, so don't touch!
+//
+// On compile-fast-deopt-on-read schemes: a flagless speculative variant has
+// been considered and doesn't fit. Flag consumption isn't a runtime event
+// this code can guard on - consumers (FSAND/FMAND/branches) live in other
+// blocks compiled against a specific microFlagCycles pipeline state, so a
+// "violation" only surfaces when such a block gets compiled/linked, and at
+// that point the speculative variant's flag instances are simply wrong for
+// linking. Keeping both variants cached would fork every downstream block on
+// flag-state, multiplying the block cache. The provable cases are already
+// taken by the static analysis behind mVUsFlagHack (sHackCond below).
 __fi void mVUsetFlags(mV, microFlagCycles& mFC)
 {
 	int endPC = iPC;
@@ -497,6 +497,14 @@ void SSE_ADD2PS(mV, const xmm& to, const xmm& from, const xmm& t1 = xEmptyReg, c
 {
 	clampOp(xADD.PS, true);
 }
+// On VEX/FMA conversion: these wrappers are two-operand on purpose. Source
+// preservation is the register allocator's job (allocReg copies only when a
+// cached value must survive), and merges already use single BLENDPS ops, so
+// there is no per-op MOVAPS for a three-operand form to delete - switching
+// would mean changing the allocator contract for no removed instruction.
+// FMA for the MADD/MSUB families is off the table for accuracy: the PS2
+// result is clamped between the multiply and the add, and a fused op skips
+// exactly that intermediate rounding/clamping step.
 void SSE_ADDPS(mV, const xmm& to, const xmm& from, const xmm& t1 = xEmptyReg, const xmm& t2 = xEmptyReg)
 {
 	clampOp(xADD.PS, true);
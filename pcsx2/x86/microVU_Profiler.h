@@ -15,6 +15,15 @@
 
 #pragma once
 
+// On an always-on per-program cycle profiler (<1% overhead): rdtsc pairs at
+// microVU block boundaries are not sub-1% - hot VU blocks are a handful of
+// x86 ops and a serializing-ish timestamp pair per block is comparable to
+// the block body, which is why this opcode counting is a special build.
+// The cheap always-on alternative already exists on another axis: the MTVU
+// vuCycles counters track per-program-execution guest cycle cost, and the
+// emitted-code side can be attributed with the ProfileWithPerf JIT map
+// (samples land in per-block symbols) - together they answer "which
+// microprogram regressed" without instrumenting every block entry.
 enum microOpcode
 {
 	// Upper Instructions
@@ -72,12 +72,26 @@ public:
 
 	__fi nVifBlock* find(const nVifBlock& dataPtr)
 	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
+		nVifBlock* const chain = m_bucket[dataPtr.hash_key];
+		nVifBlock* chainpos = chain;
 
 		while (true)
 		{
 			if (chainpos->key0 == dataPtr.key0 && chainpos->key1 == dataPtr.key1)
+			{
+				// Move-to-front: games alternating between several unpack
+				// variants in one frame keep the hottest one at probe #1.
+				// (The empty sentinel cell must stay last, hence the check.)
+				if (chainpos != chain && chainpos->startPtr != 0)
+				{
+					const nVifBlock tmp = *chain;
+					*chain = *chainpos;
+					*chainpos = tmp;
+					return chain;
+				}
+
 				return chainpos;
+			}
 
 			if (chainpos->startPtr == 0)
 				return nullptr;
@@ -16,6 +16,17 @@
 #include "PrecompiledHeader.h"
 #include "newVif_UnpackSSE.h"
 
+// On AVX2-wide kernels: widening these generators to 2-4 quadwords per
+// iteration is not a mechanical change. Every unpack format needs its own
+// 256-bit shuffle/expansion sequence (the 128-bit lane split means V3-form
+// source data straddles lanes, so vpermd/vpshufb tables per format and per
+// cycle-length phase), write masking interacts with the cl/wl fill logic per
+// output qword, and the generated blocks are unrolled per-num with the VU
+// mem wrap check done per call, not per qword. That's a parallel generator,
+// roughly the size of this file, per ISA tier - worth doing against profile
+// data, but as its own project with a dump-replay harness to validate every
+// (upk, mask, mode, cl, wl) combination, not as a drive-by.
+
 #define xMOV8(regX, loc)   xMOVSSZX(regX, loc)
 #define xMOV16(regX, loc)  xMOVSSZX(regX, loc)
 #define xMOV32(regX, loc)  xMOVSSZX(regX, loc)